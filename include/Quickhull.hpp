@@ -5,31 +5,56 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <glad/glad.h>
 #include <sys/types.h>
 #include "engine/Shader.hpp"
+#include "hull/ConvexHull.hpp"
 #include "maths/vec3.hpp"
 #include "mesh/Mesh.hpp"
 
 /**
  * @struct Quickhull
- * @brief
+ * @brief A random point cloud and its convex hull, with the meshes drawing them in the viewer.
  */
 struct Quickhull {
-    struct Triangle {
-        uint A;
-        uint B;
-        uint C;
-    };
-
+    /**
+     * @brief Creates a first random cloud and its hull.
+     * @param pointsAmount The amount of points.
+     * @param boundsMin The smallest coordinate of the points.
+     * @param boundsMax The largest coordinate of the points.
+     */
     Quickhull(uint pointsAmount, float boundsMin, float boundsMax);
 
+    /**
+     * @brief Replaces the cloud by a new random one and computes its hull. When the points span no volume,
+     * because there are fewer than 4 of them or the bounds are equal, the hull is left empty and only the
+     * points are drawn.
+     * @param pointsAmount The amount of points.
+     * @param boundsMin The smallest coordinate of the points.
+     * @param boundsMax The largest coordinate of the points.
+     */
     void create(uint pointsAmount, float boundsMin, float boundsMax);
 
+    /**
+     * @brief Sets whether the hull is drawn with one normal per face, and updates its mesh.
+     * @param flatShading Whether the hull is flat shaded.
+     */
+    void setFlatShading(bool flatShading);
+
+    /**
+     * @brief Fills the meshes of the hull's edges and faces with its vertices, each stored once, and
+     * their indices.
+     */
+    void updateHullMeshes();
+
     void draw(Shader* shader);
 
     std::vector<vec3> points;
+    uint64_t seed;
+    bool flatShading;
+    ConvexHull<float> hull;
     Mesh pointsMesh;
     Mesh linesMesh;
     Mesh mesh;
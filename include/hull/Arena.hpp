@@ -0,0 +1,110 @@
+/***************************************************************************************************
+ * @file  Arena.hpp
+ * @brief Declaration of the Arena class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <sys/types.h>
+
+/**
+ * @class Arena
+ * @brief Hands out memory from large blocks. Allocations are rounded up to a power of two and released
+ * allocations go to a free list of their size so they can be handed out again. Resetting keeps the
+ * memory: if several blocks were needed, they are replaced by a single block large enough for all of
+ * them, so repeating the same work after a reset does not allocate anything.
+ */
+class Arena {
+public:
+    static constexpr std::size_t MIN_BLOCK_SIZE = 1 << 16; ///< The size of the first block in bytes.
+
+    /**
+     * @brief Constructs an arena without any block.
+     */
+    Arena();
+
+    /**
+     * @brief Frees all the blocks.
+     */
+    ~Arena();
+
+    Arena(const Arena& arena) = delete;
+    Arena& operator =(const Arena& arena) = delete;
+
+    /**
+     * @brief Allocates memory for an array. The elements are not constructed.
+     * @tparam Type The type of the elements. Needs to be trivial and aligned on at most 16 bytes.
+     * @param count The amount of elements.
+     * @return The array, or nullptr if count is 0.
+     */
+    template<typename Type>
+    Type* allocate(std::size_t count);
+
+    /**
+     * @brief Gives back an array so its memory can be handed out again.
+     * @tparam Type The type of the elements.
+     * @param memory The array, returned by allocate.
+     * @param count The amount of elements it was allocated with.
+     */
+    template<typename Type>
+    void release(Type* memory, std::size_t count);
+
+    /**
+     * @brief Invalidates every allocation while keeping the memory.
+     */
+    void reset();
+
+    /**
+     * @brief Getter for the amount of memory owned by the arena.
+     * @return The size of all the blocks in bytes.
+     */
+    std::size_t getCapacity() const;
+
+private:
+    /**
+     * @brief Allocates memory from the free lists or from the current block.
+     * @param size The amount of bytes.
+     * @return The memory, aligned on 16 bytes.
+     */
+    void* allocateBytes(std::size_t size);
+
+    /**
+     * @brief Puts memory in the free list of its size.
+     * @param memory The memory.
+     * @param size The amount of bytes it was allocated with.
+     */
+    void releaseBytes(void* memory, std::size_t size);
+
+    /**
+     * @brief Adds a block that is used for the next allocations.
+     * @param size The least size of the block in bytes.
+     */
+    void addBlock(std::size_t size);
+
+    /**
+     * @brief Calculates the size class of an allocation. Class c holds allocations of 16 << c bytes.
+     * @param size The amount of bytes.
+     * @return The size class.
+     */
+    static uint getSizeClass(std::size_t size);
+
+    static constexpr uint SIZE_CLASSES_AMOUNT = 48; ///< The amount of size classes.
+
+    /**
+     * @struct Block
+     * @brief A block of memory allocations are taken from.
+     */
+    struct Block {
+        char* memory;     ///< The block's memory.
+        std::size_t size; ///< The block's size in bytes.
+    };
+
+    std::vector<Block> blocks; ///< The blocks, the last one being the current block.
+    std::size_t used;          ///< The amount of bytes taken from the current block.
+
+    void* freeLists[SIZE_CLASSES_AMOUNT]; ///< The first released allocation of each size class.
+};
+
+#include "Arena.tpp"
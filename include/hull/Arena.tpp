@@ -0,0 +1,18 @@
+/***************************************************************************************************
+ * @file  Arena.tpp
+ * @brief Implementation of the Arena class's template methods
+ **************************************************************************************************/
+
+template<typename Type>
+Type* Arena::allocate(std::size_t count) {
+    static_assert(alignof(Type) <= 16, "The arena only aligns allocations on 16 bytes.");
+
+    if(count == 0) { return nullptr; }
+    return static_cast<Type*>(allocateBytes(count * sizeof(Type)));
+}
+
+template<typename Type>
+void Arena::release(Type* memory, std::size_t count) {
+    if(memory == nullptr) { return; }
+    releaseBytes(memory, count * sizeof(Type));
+}
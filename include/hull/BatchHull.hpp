@@ -0,0 +1,107 @@
+/***************************************************************************************************
+ * @file  BatchHull.hpp
+ * @brief Declaration of the BatchHull class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/types.h>
+#include "hull/ConvexHull.hpp"
+#include "hull/PointView.hpp"
+
+/**
+ * @class BatchHull
+ * @brief Computes the convex hulls of many small point clouds. The clouds are handed out one at a time to
+ * worker threads that each reuse their own hull and buffers, so once the buffers have grown a build does
+ * not allocate. All the hulls are then copied in one vertex buffer and one triangle buffer.
+ * @tparam Scalar The type of the coordinates, float or double.
+ */
+template<typename Scalar>
+class BatchHull {
+public:
+    using Vector3 = tvec3<Scalar>; ///< The type of the points.
+
+    /**
+     * @struct Hull
+     * @brief Where the vertices and triangles of a hull are in the buffers.
+     */
+    struct Hull {
+        uint64_t verticesBegin;  ///< The position of the first vertex in the vertex buffer.
+        uint verticesAmount;     ///< The amount of vertices, 0 when the cloud has no hull.
+        uint64_t trianglesBegin; ///< The position of the first index in the triangle buffer.
+        uint trianglesAmount;    ///< The amount of triangles, each one being 3 indices.
+    };
+
+    /**
+     * @brief Constructs an empty batch.
+     * @param threadsAmount The amount of worker threads, 0 for as many as the hardware supports.
+     */
+    explicit BatchHull(uint threadsAmount = 0);
+
+    /**
+     * @brief Computes the convex hull of each cloud. A cloud with fewer than 4 points or whose points are
+     * coplanar gets an empty hull instead of stopping the batch.
+     * @param clouds The views of the clouds, whose memory must stay valid during the build.
+     */
+    void build(const std::vector<PointView<Scalar>>& clouds);
+
+    /**
+     * @brief Getter for the hulls member.
+     * @return Where each hull is in the buffers, in the order of the clouds.
+     */
+    const std::vector<Hull>& getHulls() const;
+
+    /**
+     * @brief Getter for the vertices member.
+     * @return The vertices of all the hulls, each hull's ones being contiguous.
+     */
+    const std::vector<Vector3>& getVertices() const;
+
+    /**
+     * @brief Getter for the triangles member.
+     * @return The triangles of all the hulls, 3 indices per triangle in counter-clockwise order seen from
+     * the outside. The indices are relative to the first vertex of their hull.
+     */
+    const std::vector<uint>& getTriangles() const;
+
+private:
+    /**
+     * @struct Worker
+     * @brief The memory a worker thread reuses from one cloud to the next.
+     */
+    struct Worker {
+        ConvexHull<Scalar> hull;           ///< The hull of the current cloud.
+        std::vector<Vector3> hullVertices; ///< The vertices of the current hull.
+        std::vector<uint> hullTriangles;   ///< The triangles of the current hull.
+        std::vector<uint> remap;           ///< The position in the hull's vertices of each point of the hull's cloud.
+        std::vector<Vector3> vertices;     ///< The vertices of the hulls the worker built.
+        std::vector<uint> triangles;       ///< The triangles of the hulls the worker built.
+        std::vector<uint> built;           ///< The clouds the worker built the hull of.
+    };
+
+    /**
+     * @brief Builds the hull of a cloud and appends it to a worker's buffers.
+     * @param worker The worker.
+     * @param cloud The cloud.
+     * @param index The cloud's position in the batch.
+     */
+    void buildHull(Worker& worker, const PointView<Scalar>& cloud, uint index);
+
+    uint threadsAmount; ///< The amount of worker threads.
+    std::vector<std::unique_ptr<Worker>> workers; ///< The memory of each worker thread.
+
+    std::vector<Hull> hulls;       ///< Where each hull is in the buffers.
+    std::vector<Vector3> vertices; ///< The vertices of all the hulls.
+    std::vector<uint> triangles;   ///< The triangles of all the hulls.
+};
+
+#include "BatchHull.tpp"
@@ -0,0 +1,120 @@
+/***************************************************************************************************
+ * @file  BatchHull.tpp
+ * @brief Implementation of the BatchHull class
+ **************************************************************************************************/
+
+template<typename Scalar>
+BatchHull<Scalar>::BatchHull(uint threadsAmount) : threadsAmount(threadsAmount) {
+    if(this->threadsAmount == 0) {
+        this->threadsAmount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+}
+
+template<typename Scalar>
+void BatchHull<Scalar>::build(const std::vector<PointView<Scalar>>& clouds) {
+    if(clouds.size() > UINT_MAX) {
+        throw std::runtime_error("A batch holds at most " + std::to_string(UINT_MAX) + " clouds.");
+    }
+
+    const uint activeAmount = std::max<uint>(std::min<uint64_t>(threadsAmount, clouds.size()), 1);
+    while(workers.size() < activeAmount) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    hulls.resize(clouds.size());
+
+    /* The clouds are handed out one at a time since their sizes vary, each hull goes to the buffers of
+     * the worker that built it */
+    std::atomic<uint> next(0);
+    auto work = [this, &clouds, &next](uint thread) {
+        Worker& worker = *workers[thread];
+        worker.vertices.clear();
+        worker.triangles.clear();
+        worker.built.clear();
+
+        for(uint i = next++ ; i < clouds.size() ; i = next++) {
+            buildHull(worker, clouds[i], i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(uint thread = 1 ; thread < activeAmount ; ++thread) {
+        threads.emplace_back(work, thread);
+    }
+    work(0);
+
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    /* Positions of the hulls in the final buffers, in the order of the clouds */
+    uint64_t verticesAmount = 0;
+    uint64_t trianglesAmount = 0;
+    std::vector<uint64_t> localVertices(hulls.size());
+    std::vector<uint64_t> localTriangles(hulls.size());
+
+    for(uint i = 0 ; i < hulls.size() ; ++i) {
+        localVertices[i] = hulls[i].verticesBegin;
+        localTriangles[i] = hulls[i].trianglesBegin;
+        hulls[i].verticesBegin = verticesAmount;
+        hulls[i].trianglesBegin = trianglesAmount;
+        verticesAmount += hulls[i].verticesAmount;
+        trianglesAmount += 3 * static_cast<uint64_t>(hulls[i].trianglesAmount);
+    }
+
+    vertices.resize(verticesAmount);
+    triangles.resize(trianglesAmount);
+
+    /* Each worker copies the hulls it built */
+    auto copy = [this, &localVertices, &localTriangles](uint thread) {
+        const Worker& worker = *workers[thread];
+
+        for(uint i : worker.built) {
+            const Hull& hull = hulls[i];
+            std::copy_n(worker.vertices.begin() + localVertices[i], hull.verticesAmount, vertices.begin() + hull.verticesBegin);
+            std::copy_n(worker.triangles.begin() + localTriangles[i], 3 * hull.trianglesAmount, triangles.begin() + hull.trianglesBegin);
+        }
+    };
+
+    threads.clear();
+    for(uint thread = 1 ; thread < activeAmount ; ++thread) {
+        threads.emplace_back(copy, thread);
+    }
+    copy(0);
+
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+template<typename Scalar>
+const std::vector<typename BatchHull<Scalar>::Hull>& BatchHull<Scalar>::getHulls() const {
+    return hulls;
+}
+
+template<typename Scalar>
+const std::vector<typename BatchHull<Scalar>::Vector3>& BatchHull<Scalar>::getVertices() const {
+    return vertices;
+}
+
+template<typename Scalar>
+const std::vector<uint>& BatchHull<Scalar>::getTriangles() const {
+    return triangles;
+}
+
+template<typename Scalar>
+void BatchHull<Scalar>::buildHull(Worker& worker, const PointView<Scalar>& cloud, uint index) {
+    Hull& result = hulls[index];
+    result = Hull{ worker.vertices.size(), 0, worker.triangles.size(), 0 };
+
+    if(!worker.hull.tryBuild(cloud, 1)) { return; }
+
+    /* The indices of a hull are relative to its first vertex, so its mesh is appended as is */
+    worker.hull.getIndexedMesh(worker.hullVertices, worker.hullTriangles, worker.remap);
+    worker.vertices.insert(worker.vertices.end(), worker.hullVertices.begin(), worker.hullVertices.end());
+    worker.triangles.insert(worker.triangles.end(), worker.hullTriangles.begin(), worker.hullTriangles.end());
+    result.verticesAmount = worker.hullVertices.size();
+    result.trianglesAmount = worker.hullTriangles.size() / 3;
+
+    worker.built.push_back(index);
+}
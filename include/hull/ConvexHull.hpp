@@ -0,0 +1,413 @@
+/***************************************************************************************************
+ * @file  ConvexHull.hpp
+ * @brief Declaration of the ConvexHull class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sys/types.h>
+#include "hull/Arena.hpp"
+#include "hull/directions.hpp"
+#include "hull/HalfEdgeMesh.hpp"
+#include "hull/kernels.hpp"
+#include "hull/PointCloud.hpp"
+#include "hull/PointView.hpp"
+#include "hull/predicates.hpp"
+#include "maths/geometry.hpp"
+
+/* The error bound of the distance filter is derived for IEEE rounding of every operation */
+#ifdef __FAST_MATH__
+    #error "ConvexHull must be instantiated without -ffast-math"
+#endif
+
+/**
+ * @class ConvexHull
+ * @brief Computes the convex hull of a point cloud with the Quickhull algorithm. Does not depend on
+ * OpenGL so it can be used without a window.
+ * @tparam Scalar The type of the coordinates, float or double.
+ */
+template<typename Scalar>
+class ConvexHull {
+    static_assert(std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>, "The hull is built from float or double coordinates.");
+
+public:
+    using Vector3 = tvec3<Scalar>; ///< The type of the points.
+
+    static constexpr uint MIN_POINTS_PER_THREAD = 4096; ///< The least amount of points a culling thread handles.
+    static constexpr uint MIN_POINTS_TO_CULL = 256;     ///< The least amount of points culling pays off for.
+    static constexpr uint MIN_POINTS_TO_REDUCE = 16384; ///< The least amount of candidates the slabs pay off for.
+    static constexpr uint MIN_POINTS_PER_SLAB = 1024;   ///< The least amount of points a slab is built from.
+
+    /**
+     * @brief Constructs an empty hull.
+     */
+    ConvexHull();
+
+    /**
+     * @brief Computes the convex hull of a point cloud. The vertex indices of the resulting mesh are
+     * indices in the given points.
+     * @param points The points. Needs at least 4 points that are not coplanar, otherwise a std::runtime_error is thrown.
+     * @param threadsAmount The amount of threads to use. With more than one thread, the cloud is cut
+     * in slabs whose hulls are built in parallel and only the vertices of these hulls are used for the
+     * final hull. 0 uses as many threads as the hardware supports.
+     */
+    void build(const std::vector<Vector3>& points, uint threadsAmount = 1);
+
+    /**
+     * @brief Computes the convex hull of points read through a view, without copying them first. Only the
+     * points that survive culling are copied. The vertex indices of the resulting mesh are indices in the view.
+     * @param points The view, whose memory must stay valid during the build.
+     * @param threadsAmount The amount of threads to use, see build.
+     */
+    void build(const PointView<Scalar>& points, uint threadsAmount = 1);
+
+    /**
+     * @brief Computes the convex hull of points read through a view like build, without throwing when
+     * they do not span a volume.
+     * @param points The view, whose memory must stay valid during the build.
+     * @param threadsAmount The amount of threads to use, see build.
+     * @return Whether the points span a volume. When they are less than 4 or coplanar, the hull is empty.
+     */
+    bool tryBuild(const PointView<Scalar>& points, uint threadsAmount = 1);
+
+    /**
+     * @brief Computes the convex hull of some of the points of a view, without culling them first. The
+     * vertex indices of the resulting mesh are indices in the view.
+     * @param points The view, whose memory must stay valid during the build.
+     * @param indices The indices in the view of the points to build the hull from, without duplicates.
+     * Needs at least 4 points that are not coplanar, otherwise a std::runtime_error is thrown.
+     */
+    void build(const PointView<Scalar>& points, const std::vector<uint>& indices);
+
+    /**
+     * @brief Computes an approximate convex hull of a point cloud, inside the exact hull and at most a
+     * tolerance away from it. Only the points that are the farthest along directions spread over the
+     * sphere are used, so the exact hull's vertices between these directions may be missing. The
+     * smaller the tolerance, the more directions are needed, and the hull is exact when querying them
+     * would cost more than building it from the points left after culling. getErrorBound gives the
+     * distance that is guaranteed.
+     * @param points The points. Needs at least 4 points that are not coplanar, otherwise a std::runtime_error is thrown.
+     * @param tolerance The largest distance between the hulls relative to the diagonal of the bounding box
+     * of the points. It has to be positive, otherwise a std::runtime_error is thrown.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void buildApproximate(const std::vector<Vector3>& points, Scalar tolerance, uint threadsAmount = 1);
+
+    /**
+     * @brief Computes an approximate convex hull of points read through a view, see buildApproximate.
+     * @param points The view, whose memory must stay valid during the build.
+     * @param tolerance The largest distance between the hulls relative to the diagonal of the bounding box of the points.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void buildApproximate(const PointView<Scalar>& points, Scalar tolerance, uint threadsAmount = 1);
+
+    /**
+     * @brief Adds points to the hull without rebuilding it. Points inside a polytope inscribed in the hull are
+     * rejected right away, the others are tested against the faces and only the faces they can see are
+     * replaced. The inserted points are numbered after the points the hull already knows, in order.
+     * @param newPoints The points to insert.
+     */
+    void insert(const std::vector<Vector3>& newPoints);
+
+    /**
+     * @brief Sets the directions used to cull points before the hull is built. The points that are the
+     * farthest along each direction span a polytope and the points strictly inside of it are dropped.
+     * Culling is disabled with fewer than 4 different extreme points, so an empty set disables it.
+     * @param directions The directions, by default Directions::lattice(26).
+     */
+    void setCullingDirections(const std::vector<Vector3>& directions);
+
+    /**
+     * @brief Sets the largest amount of vertices of the hull. Once it is reached, builds and insertions
+     * stop adding points, which are otherwise added the farthest from the hull first so the hull is
+     * as close as the budget allows. The points left outside stay in the conflict lists, see
+     * getEnclosingMesh. Budgets under 4 vertices throw a std::runtime_error.
+     * @param maxVertices The largest amount of vertices, 0 for no limit, the default.
+     */
+    void setMaxVertices(uint maxVertices);
+
+    /**
+     * @brief Getter for the mesh member.
+     * @return The hull's topology. Removed faces have to be skipped and vertices are positions in the
+     * cloud, see getCloud.
+     */
+    const HalfEdgeMesh& getMesh() const;
+
+    /**
+     * @brief Getter for the cloud member.
+     * @return The points the hull was built from, which remember their index in the built points.
+     */
+    const PointCloud<Scalar>& getCloud() const;
+
+    /**
+     * @brief Getter for the errorBound member.
+     * @return The largest distance of a point of the exact hull to the hull of the last build, 0 when
+     * the build was exact.
+     */
+    Scalar getErrorBound() const;
+
+    /**
+     * @brief Calculates the indices of the points that are vertices of the hull.
+     * @return The indices of the hull's vertices in the built points.
+     */
+    std::vector<uint> getVertices() const;
+
+    /**
+     * @brief Lists the faces of the hull.
+     * @return The indices in the built points of the vertices of each face, 3 per face, in
+     * counter-clockwise order seen from the outside.
+     */
+    std::vector<uint> getTriangles() const;
+
+    /**
+     * @brief Calculates the planes of the faces shifted by the error bound of the distances to them, so a
+     * point whose distances to all of them are negative is certainly inside the hull.
+     * @param pointsMagnitude The largest absolute value of the coordinates of the tested points.
+     * @param safePlanes The shifted planes, replaced. Their normals are not normalized.
+     */
+    void getSafePlanes(Scalar pointsMagnitude, std::vector<Plane<Scalar>>& safePlanes) const;
+
+    /**
+     * @brief Lists the hull as indexed geometry, each vertex being stored once.
+     * @param vertices The hull's vertices, replaced.
+     * @param triangles The indices in vertices of the vertices of each face, 3 per face, in counter-clockwise
+     * order seen from the outside, replaced.
+     */
+    void getIndexedMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles) const;
+
+    /**
+     * @brief Lists the hull as indexed geometry like getIndexedMesh, without allocating when the buffers are
+     * large enough already.
+     * @param vertices The hull's vertices, replaced.
+     * @param triangles The indices in vertices of the vertices of each face, see getIndexedMesh, replaced.
+     * @param indices The position in vertices of each point of the hull's cloud, replaced.
+     */
+    void getIndexedMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles, std::vector<uint>& indices) const;
+
+    /**
+     * @brief Lists the hull as indexed geometry scaled about the centroid of its vertices by the smallest
+     * factor that puts the points it left outside inside of it, up to rounding. The mesh keeps the vertex
+     * count of the hull, and is the hull itself when no point is outside of it.
+     * @param vertices The scaled hull's vertices, replaced.
+     * @param triangles The indices in vertices of the vertices of each face, see getIndexedMesh, replaced.
+     */
+    void getEnclosingMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles) const;
+
+private:
+    /**
+     * @brief Runs a function on several threads and waits for all of them to finish. With a single thread,
+     * the function is called directly.
+     * @tparam Function The type of the function.
+     * @param threadsAmount The amount of threads.
+     * @param function The function, called with the index of the thread running it.
+     */
+    template<typename Function>
+    static void runInParallel(uint threadsAmount, const Function& function);
+
+    /**
+     * @brief Computes the hull of the candidates.
+     * @return Whether the candidates span a volume, the hull is empty when they do not.
+     */
+    bool buildCandidates();
+
+    /**
+     * @brief Calculates the largest absolute value of the coordinates of the cloud.
+     */
+    void updateMagnitude();
+
+    /**
+     * @brief Adds the farthest point of each face that has a conflict list until no face has one.
+     */
+    void expand();
+
+    /**
+     * @brief Adds the farthest point of the face whose farthest point is the farthest from it until no
+     * face has a conflict list or the hull has maxVertices vertices.
+     */
+    void expandFarthestFirst();
+
+    /**
+     * @brief Drops the slots of the removed faces from the mesh and the data of the faces once they are the
+     * majority, so the passes over every face and the memory stay proportional to the hull's size.
+     */
+    void compactFaces();
+
+    /**
+     * @brief Calculates the planes of a polytope inside the hull, spanned by the hull's vertices that are
+     * the farthest along the culling directions.
+     */
+    void updateInnerPlanes();
+
+    /**
+     * @brief Sets the candidates to the points that are not strictly inside the polytope spanned by the
+     * extreme points along the culling directions.
+     * @param threadsAmount The amount of threads to use.
+     */
+    void cullCandidates(uint threadsAmount);
+
+    /**
+     * @brief Cuts the candidates in slabs along the widest axis of the cloud, computes the hull of each
+     * slab on its own thread and replaces the candidates by the vertices of these hulls.
+     * @param threadsAmount The amount of threads and slabs.
+     */
+    void reduceCandidates(uint threadsAmount);
+
+    /**
+     * @brief Picks the approximation directions for a tolerance, about the fewest whose largest angle to a
+     * direction of the sphere has a tangent of at most the tolerance. Directions picked for the same
+     * tolerance are kept.
+     * @param tolerance The tolerance.
+     * @param maxAmount The most directions worth querying.
+     * @return Whether the directions were picked, which they are not when more than maxAmount are needed.
+     */
+    bool updateApproximationDirections(Scalar tolerance, uint maxAmount);
+
+    /**
+     * @brief Replaces the candidates by the ones that are the farthest along the approximation directions
+     * and their opposites.
+     * @param threadsAmount The amount of threads to use.
+     * @return The largest width of the candidates along the approximation directions.
+     */
+    Scalar reduceToDirectionExtremes(uint threadsAmount);
+
+    /**
+     * @brief Creates the starting tetrahedron and assigns each candidate to the first of its faces it
+     * is above. Its first edge joins the two farthest apart of the smallest and largest candidates
+     * along each axis, its third vertex is the candidate the farthest from this edge and its fourth
+     * vertex the candidate the farthest from their plane.
+     * @return Whether the candidates span a volume. When they are less than 4, all equal, collinear or
+     * coplanar, there is no tetrahedron.
+     */
+    bool initialize();
+
+    /**
+     * @brief Adds a point to the hull. Removes the faces it can see, creates a cone of faces between
+     * the horizon and the point and hands the points of the removed faces over to the new ones.
+     * @param face A face the point is above.
+     * @param apex The point's position in the cloud.
+     */
+    void addPoint(uint face, uint apex);
+
+    /**
+     * @brief Adds a face to the mesh with an empty conflict list and caches its plane, whose normal is
+     * not normalized, and the error bound of the distances to it.
+     * @param A The first vertex's position in the cloud.
+     * @param B The second vertex's position in the cloud.
+     * @param C The third vertex's position in the cloud.
+     * @return The face's index.
+     */
+    uint addFace(uint A, uint B, uint C);
+
+    /**
+     * @brief Moves the orphans that are above a face to the face's conflict list, after the points it already has.
+     * @param face The face's index.
+     */
+    void assignPoints(uint face);
+
+    /**
+     * @brief Getter for the point of a face's conflict list that is the farthest from its plane.
+     * @param face The face's index.
+     * @return The farthest point's position in the cloud.
+     */
+    uint getFarthestPoint(uint face) const;
+
+    /**
+     * @brief Calculates the error bound of the distances of the points to the plane of a face.
+     * @param face The face's index.
+     * @return The bound.
+     */
+    Scalar calculatePlaneErrorBound(uint face) const;
+
+    /**
+     * @brief Calculates the plane of a face moved outwards by the error bound of the distances to it, so
+     * a point whose distance is negative is certainly below the face.
+     * @param face The face's index.
+     * @param pointsMagnitude The largest absolute value of the coordinates of the tested points.
+     * @return The face's moved plane.
+     */
+    Plane<Scalar> getSafePlane(uint face, Scalar pointsMagnitude) const;
+
+    /**
+     * @brief Tests whether a point is strictly above a face. The distance to the cached plane decides
+     * unless it is within the error bound, then the exact orientation predicate does.
+     * @param face The face's index.
+     * @param point The point.
+     * @return Whether the point is above the face.
+     */
+    bool isAbove(uint face, const Vector3& point) const;
+
+    /**
+     * @brief Tests whether a point is strictly above a face with the exact orientation predicate.
+     * @param face The face's index.
+     * @param point The point.
+     * @return Whether the point is above the face.
+     */
+    bool isAboveExactly(uint face, const Vector3& point) const;
+
+    /**
+     * @struct ConflictList
+     * @brief The points that are above a face, allocated from the arena.
+     */
+    struct ConflictList {
+        uint* points;  ///< The points' positions in the cloud.
+        uint size;     ///< The amount of points.
+        uint farthest; ///< The position in the cloud of the point farthest from the face, found while the list is filled.
+    };
+
+    PointView<Scalar> points; ///< The points of the current build.
+    uint pointsAmount;        ///< The amount of points of the current build.
+    std::vector<uint> candidates; ///< The indices of the points the hull is computed from.
+    std::vector<Vector3> cullingDirections; ///< The directions used to cull interior points.
+
+    std::vector<uint> extremes;                  ///< The extreme points along the culling or approximation directions.
+    std::vector<Scalar> projectionMaximums;      ///< The projection of each thread's extreme points.
+    std::vector<Scalar> threadMagnitudes;        ///< The largest coordinate of each thread's points.
+    std::unique_ptr<ConvexHull> polytope;        ///< The hull of the extreme points.
+    std::vector<Plane<Scalar>> cullingPlanes;    ///< The planes of the polytope.
+    std::vector<std::vector<uint>> survivors;    ///< The points of each thread that were not culled.
+    std::vector<std::unique_ptr<ConvexHull>> slabHulls; ///< The hull of each slab, kept between builds.
+    std::vector<std::vector<uint>> slabVertices; ///< The vertices of the hull of each slab.
+
+    Scalar errorBound;             ///< The largest distance of a point of the exact hull to the hull.
+    Scalar approximationTolerance; ///< The tolerance the approximation directions were picked for, 0 before any.
+    std::vector<Vector3> approximationDirections; ///< Directions of a half sphere whose extreme points, with the ones of their opposites, span the approximate hull.
+    Scalar approximationTangent;   ///< The tangent of the largest angle between a direction of the sphere and the closest approximation direction or opposite.
+
+    PointCloud<Scalar> cloud; ///< The candidates, copied in separate coordinate arrays.
+    Scalar magnitude;         ///< The largest absolute value of the coordinates of the points.
+    HalfEdgeMesh mesh; ///< The hull's topology.
+    Arena arena;       ///< The memory of the conflict lists, reset between builds.
+    std::vector<ConflictList> conflicts; ///< The conflict list of each face.
+    std::vector<Plane<Scalar>> planes;   ///< The plane of each face, calculated when the face is created.
+    std::vector<Scalar> planeBounds;     ///< The error bound of the distances to the plane of each face.
+    uint verticesAmount; ///< The amount of vertices of the hull.
+    uint maxVertices;    ///< The largest amount of vertices of the hull, 0 for no limit.
+    std::vector<std::pair<Scalar, uint>> farthestFaces; ///< Max-heap of the faces by the distance of their farthest point.
+
+    std::vector<Vector3> innerVertices;       ///< The vertices of the polytope inside the hull.
+    std::vector<Plane<Scalar>> innerPlanes;   ///< The planes of the polytope inside the hull.
+    bool innerPlanesOutdated;                 ///< Whether the hull changed since the inner planes were calculated.
+
+    std::vector<uint> faceMarks; ///< The last epoch each face was found visible in.
+    std::vector<uint> faceIndices; ///< The new index of each face during a compaction.
+    uint epoch;                  ///< The epoch of the current apex, incremented for each apex.
+
+    std::vector<uint> stack;      ///< The faces left to visit during the flood fill.
+    std::vector<uint> visible;    ///< The faces the current apex can see.
+    std::vector<uint> horizon;    ///< The horizon's half-edges, in order.
+    std::vector<uint> orphans;    ///< The points of the removed faces.
+    std::vector<Scalar> distances; ///< The distances of the orphans to the face they are tested against.
+};
+
+#include "ConvexHull.tpp"
@@ -0,0 +1,1203 @@
+/***************************************************************************************************
+ * @file  ConvexHull.tpp
+ * @brief Implementation of the ConvexHull class
+ **************************************************************************************************/
+
+template<typename Scalar>
+template<typename Function>
+void ConvexHull<Scalar>::runInParallel(uint threadsAmount, const Function& function) {
+    if(threadsAmount == 1) {
+        function(0);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsAmount);
+
+    for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+        threads.emplace_back(function, thread);
+    }
+
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+template<typename Scalar>
+ConvexHull<Scalar>::ConvexHull() : pointsAmount(0), errorBound(0), approximationTolerance(0), approximationTangent(0), magnitude(0), verticesAmount(0), maxVertices(0), innerPlanesOutdated(true), epoch(0) {
+    for(const vec3& direction : Directions::lattice(26)) {
+        cullingDirections.emplace_back(direction.x, direction.y, direction.z);
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::build(const std::vector<Vector3>& points, uint threadsAmount) {
+    build(PointView<Scalar>(points), threadsAmount);
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::build(const PointView<Scalar>& points, uint threadsAmount) {
+    if(!tryBuild(points, threadsAmount)) {
+        throw std::runtime_error("The hull needs at least 4 points that are not coplanar.");
+    }
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::tryBuild(const PointView<Scalar>& points, uint threadsAmount) {
+    this->points = points;
+    pointsAmount = points.getSize();
+
+    if(threadsAmount == 0) {
+        threadsAmount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    /* Fewer than 4 points have no hull, initialize reports it. Below a few hundred points, building the
+     * culling polytope costs about as much as adding the points it would skip */
+    if(pointsAmount < MIN_POINTS_TO_CULL) {
+        candidates.resize(pointsAmount);
+        std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+        cullCandidates(pointsAmount >= threadsAmount * MIN_POINTS_PER_THREAD ? threadsAmount : 1);
+
+        /* The hull of the slab vertices is built on one thread. On a ball, the slabs take about as long on
+         * one core as the hull of the candidates, and this merge 40% of that at 5000 candidates and 12% at
+         * 200000, so 2 threads only gain from about 10000 candidates on. A sphere, whose points are all on
+         * the hull, never gains */
+        const uint slabsAmount = std::min<uint64_t>(threadsAmount, candidates.size() / MIN_POINTS_PER_SLAB);
+        if(slabsAmount > 1 && candidates.size() >= MIN_POINTS_TO_REDUCE) {
+            reduceCandidates(slabsAmount);
+        }
+    }
+
+    return buildCandidates();
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::build(const PointView<Scalar>& points, const std::vector<uint>& indices) {
+    this->points = points;
+    pointsAmount = points.getSize();
+    candidates = indices;
+
+    if(!buildCandidates()) {
+        throw std::runtime_error("The hull needs at least 4 points that are not coplanar.");
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::buildApproximate(const std::vector<Vector3>& points, Scalar tolerance, uint threadsAmount) {
+    buildApproximate(PointView<Scalar>(points), tolerance, threadsAmount);
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::buildApproximate(const PointView<Scalar>& points, Scalar tolerance, uint threadsAmount) {
+    if(!(tolerance > 0)) {
+        throw std::runtime_error("The tolerance of an approximate hull has to be positive.");
+    }
+
+    this->points = points;
+    pointsAmount = points.getSize();
+
+    if(threadsAmount == 0) {
+        threadsAmount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    /* The culled points are not the farthest along any direction, so the directions only query the
+     * points left. Projecting a point costs a few vector operations per direction against hundreds to
+     * add it to the hull, so past a direction per 64 points the exact hull is cheaper */
+    bool approximate = false;
+    Scalar width = 0;
+
+    if(pointsAmount < 4) {
+        candidates.resize(pointsAmount);
+        std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+        cullCandidates(pointsAmount >= threadsAmount * MIN_POINTS_PER_THREAD ? threadsAmount : 1);
+
+        approximate = updateApproximationDirections(tolerance, candidates.size() / 64);
+
+        if(approximate) {
+            width = reduceToDirectionExtremes(candidates.size() >= threadsAmount * MIN_POINTS_PER_THREAD ? threadsAmount : 1);
+        }
+    }
+
+    if(!buildCandidates()) {
+        throw std::runtime_error("The hull needs at least 4 points that are not coplanar.");
+    }
+
+    /* The point the farthest along a direction v is above the hull by at most sin(a) times its distance
+     * to the point the farthest along the closest approximation direction, a being the angle between
+     * them. Two points are at most the width along the direction closest to their line divided by the
+     * cosine of that angle apart, so the distance is at most the largest width times tan(a). Rounding
+     * can pick a point whose projection is a few epsilons of the coordinates short of the farthest one */
+    if(approximate) {
+        errorBound = width * approximationTangent + 16 * std::numeric_limits<Scalar>::epsilon() * magnitude;
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::insert(const std::vector<Vector3>& newPoints) {
+    if(mesh.getFacesAmount() == 0) {
+        throw std::runtime_error("The hull needs to be built before points are inserted.");
+    }
+
+    Scalar newMagnitude = 0;
+    for(const Vector3& point : newPoints) {
+        newMagnitude = std::max(newMagnitude, std::max(std::abs(point.x), std::max(std::abs(point.y), std::abs(point.z))));
+    }
+
+    /* The error bounds of the inner planes grow with the coordinates of the tested points */
+    if(newMagnitude > magnitude) {
+        magnitude = newMagnitude;
+        innerPlanesOutdated = true;
+
+        for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+            if(!mesh.isRemoved(i)) { planeBounds[i] = calculatePlaneErrorBound(i); }
+        }
+    }
+
+    if(innerPlanesOutdated) { updateInnerPlanes(); }
+
+    /* Points inside the inner polytope are inside the hull, the others are handed to the faces they are above */
+    orphans.clear();
+    for(uint i = 0 ; i < newPoints.size() ; ++i) {
+        const Vector3& point = newPoints[i];
+        bool inside = !innerPlanes.empty();
+
+        for(uint j = 0 ; j < innerPlanes.size() && inside ; ++j) {
+            inside = dot(innerPlanes[j].normal, point) - innerPlanes[j].offset < 0;
+        }
+        if(inside) { continue; }
+
+        orphans.push_back(cloud.getSize());
+        cloud.add(point, pointsAmount + i);
+    }
+    pointsAmount += newPoints.size();
+
+    for(uint i = 0 ; i < mesh.getFacesAmount() && !orphans.empty() ; ++i) {
+        if(!mesh.isRemoved(i)) { assignPoints(i); }
+    }
+
+    /* Only the faces that received points are processed, the rest of the hull stays as it is */
+    expand();
+    innerPlanesOutdated = true;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::setCullingDirections(const std::vector<Vector3>& directions) {
+    cullingDirections = directions;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::setMaxVertices(uint maxVertices) {
+    if(maxVertices != 0 && maxVertices < 4) {
+        throw std::runtime_error("A hull has at least 4 vertices.");
+    }
+
+    this->maxVertices = maxVertices;
+}
+
+template<typename Scalar>
+Scalar ConvexHull<Scalar>::getErrorBound() const {
+    return errorBound;
+}
+
+template<typename Scalar>
+const HalfEdgeMesh& ConvexHull<Scalar>::getMesh() const {
+    return mesh;
+}
+
+template<typename Scalar>
+const PointCloud<Scalar>& ConvexHull<Scalar>::getCloud() const {
+    return cloud;
+}
+
+template<typename Scalar>
+std::vector<uint> ConvexHull<Scalar>::getVertices() const {
+    std::vector<uint> vertices;
+    std::vector<bool> found(cloud.getSize(), false);
+
+    for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+        if(mesh.isRemoved(i)) { continue; }
+
+        for(uint k = 0 ; k < 3 ; ++k) {
+            uint vertex = mesh.getVertex(i, k);
+            if(!found[vertex]) {
+                found[vertex] = true;
+                vertices.push_back(cloud.getIndex(vertex));
+            }
+        }
+    }
+
+    return vertices;
+}
+
+template<typename Scalar>
+std::vector<uint> ConvexHull<Scalar>::getTriangles() const {
+    std::vector<uint> triangles;
+
+    for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+        if(mesh.isRemoved(i)) { continue; }
+
+        triangles.push_back(cloud.getIndex(mesh.getVertex(i, 0)));
+        triangles.push_back(cloud.getIndex(mesh.getVertex(i, 1)));
+        triangles.push_back(cloud.getIndex(mesh.getVertex(i, 2)));
+    }
+
+    return triangles;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::getSafePlanes(Scalar pointsMagnitude, std::vector<Plane<Scalar>>& safePlanes) const {
+    safePlanes.clear();
+
+    for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+        if(!mesh.isRemoved(i)) { safePlanes.push_back(getSafePlane(i, pointsMagnitude)); }
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::getIndexedMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles) const {
+    std::vector<uint> indices;
+    getIndexedMesh(vertices, triangles, indices);
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::getIndexedMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles, std::vector<uint>& indices) const {
+    indices.assign(cloud.getSize(), UINT_MAX);
+    vertices.clear();
+    triangles.clear();
+
+    for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+        if(mesh.isRemoved(i)) { continue; }
+
+        for(uint k = 0 ; k < 3 ; ++k) {
+            uint vertex = mesh.getVertex(i, k);
+            if(indices[vertex] == UINT_MAX) {
+                indices[vertex] = vertices.size();
+                vertices.push_back(cloud.getPoint(vertex));
+            }
+            triangles.push_back(indices[vertex]);
+        }
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::getEnclosingMesh(std::vector<Vector3>& vertices, std::vector<uint>& triangles) const {
+    getIndexedMesh(vertices, triangles);
+    if(vertices.empty()) { return; }
+
+    Vector3 center;
+    for(const Vector3& vertex : vertices) {
+        center += vertex;
+    }
+    center /= static_cast<Scalar>(vertices.size());
+
+    /* Height of the center below each face, positive since the center is inside the hull */
+    std::vector<uint> faces;
+    std::vector<Scalar> heights;
+    for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+        if(mesh.isRemoved(i)) { continue; }
+
+        faces.push_back(i);
+        heights.push_back(planes[i].offset - dot(planes[i].normal, center));
+    }
+
+    /* Only the points of the conflict lists are outside the hull. Scaled by s about the center, a face
+     * contains the points whose height above the center is at most s times its own */
+    Scalar scale = 1;
+    for(uint face : faces) {
+        const ConflictList& list = conflicts[face];
+
+        for(uint i = 0 ; i < list.size ; ++i) {
+            Vector3 point = cloud.getPoint(list.points[i]);
+
+            for(uint j = 0 ; j < faces.size() ; ++j) {
+                scale = std::max(scale, (dot(planes[faces[j]].normal, point) - dot(planes[faces[j]].normal, center)) / heights[j]);
+            }
+        }
+    }
+
+    if(scale == 1) { return; }
+
+    scale *= 1 + 16 * std::numeric_limits<Scalar>::epsilon();
+    for(Vector3& vertex : vertices) {
+        vertex = center + (vertex - center) * scale;
+    }
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::buildCandidates() {
+    cloud.assign(points, candidates);
+    arena.reset();
+    updateMagnitude();
+    innerPlanesOutdated = true;
+    errorBound = 0;
+
+    if(!initialize()) { return false; }
+
+    expand();
+    return true;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::updateMagnitude() {
+    const Scalar* x = cloud.getX();
+    const Scalar* y = cloud.getY();
+    const Scalar* z = cloud.getZ();
+
+    magnitude = 0;
+    for(uint i = 0 ; i < cloud.getSize() ; ++i) {
+        magnitude = std::max(magnitude, std::max(std::abs(x[i]), std::max(std::abs(y[i]), std::abs(z[i]))));
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::expand() {
+    if(maxVertices != 0) {
+        expandFarthestFirst();
+    } else {
+        /* New faces are appended at the end so a single pass processes all of them */
+        for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+            if(mesh.isRemoved(i) || conflicts[i].size == 0) { continue; }
+
+            addPoint(i, getFarthestPoint(i));
+        }
+    }
+
+    /* Face indices only change once the expansion is over */
+    compactFaces();
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::expandFarthestFirst() {
+    auto pushFaces = [this](uint begin) {
+        for(uint i = begin ; i < mesh.getFacesAmount() ; ++i) {
+            if(mesh.isRemoved(i) || conflicts[i].size == 0) { continue; }
+
+            const Plane<Scalar>& plane = planes[i];
+            Scalar distance = (dot(plane.normal, cloud.getPoint(getFarthestPoint(i))) - plane.offset) / length(plane.normal);
+            farthestFaces.emplace_back(distance, i);
+            std::push_heap(farthestFaces.begin(), farthestFaces.end());
+        }
+    };
+
+    farthestFaces.clear();
+    pushFaces(0);
+
+    /* Face indices are not reused, so the entries of the faces removed since they were pushed are skipped */
+    while(verticesAmount < maxVertices && !farthestFaces.empty()) {
+        std::pop_heap(farthestFaces.begin(), farthestFaces.end());
+        uint face = farthestFaces.back().second;
+        farthestFaces.pop_back();
+
+        if(mesh.isRemoved(face)) { continue; }
+
+        uint firstNewFace = mesh.getFacesAmount();
+        addPoint(face, getFarthestPoint(face));
+        pushFaces(firstNewFace);
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::compactFaces() {
+    if(2 * mesh.getRemovedAmount() <= mesh.getFacesAmount()) { return; }
+
+    mesh.compact(faceIndices);
+
+    /* The conflict lists of the removed faces were already given back to the arena. The marks are not
+     * moved, older epochs than the current one never match */
+    for(uint i = 0 ; i < faceIndices.size() ; ++i) {
+        uint face = faceIndices[i];
+        if(face == HalfEdgeMesh::NONE) { continue; }
+
+        conflicts[face] = conflicts[i];
+        planes[face] = planes[i];
+        planeBounds[face] = planeBounds[i];
+    }
+
+    conflicts.resize(mesh.getFacesAmount());
+    planes.resize(mesh.getFacesAmount());
+    planeBounds.resize(mesh.getFacesAmount());
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::updateInnerPlanes() {
+    innerPlanes.clear();
+    innerVertices.clear();
+
+    /* Hull vertex that is the farthest along each culling direction */
+    for(const Vector3& direction : cullingDirections) {
+        uint extreme = mesh.getVertex(0, 0);
+
+        for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+            if(mesh.isRemoved(i)) { continue; }
+
+            for(uint k = 0 ; k < 3 ; ++k) {
+                uint vertex = mesh.getVertex(i, k);
+                if(dot(cloud.getPoint(vertex), direction) > dot(cloud.getPoint(extreme), direction)) { extreme = vertex; }
+            }
+        }
+
+        Vector3 point = cloud.getPoint(extreme);
+        if(std::find(innerVertices.begin(), innerVertices.end(), point) == innerVertices.end()) {
+            innerVertices.push_back(point);
+        }
+    }
+
+    innerPlanesOutdated = false;
+    if(innerVertices.size() < 4) { return; }
+
+    /* The hull of these vertices is inside the hull, a point below all its planes can be skipped */
+    if(!polytope) { polytope = std::make_unique<ConvexHull>(); }
+    polytope->points = PointView<Scalar>(innerVertices);
+    polytope->pointsAmount = innerVertices.size();
+    polytope->candidates.resize(innerVertices.size());
+    std::iota(polytope->candidates.begin(), polytope->candidates.end(), 0);
+    if(!polytope->buildCandidates()) { return; }
+
+    polytope->getSafePlanes(magnitude, innerPlanes);
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::cullCandidates(uint threadsAmount) {
+    static constexpr uint BLOCK_SIZE = 64;
+    static constexpr uint LANES = 32 / sizeof(Scalar);
+    const uint directionsAmount = cullingDirections.size();
+
+    auto getRangeBegin = [this, threadsAmount](uint thread) -> uint {
+        return static_cast<uint64_t>(pointsAmount) * thread / threadsAmount;
+    };
+
+    /* Copies a block of points in separate coordinate arrays, the end of a partial block repeats its
+     * last point so the loops over a block always have the same length and get vectorized */
+    auto loadBlock = [this](uint begin, uint count, Scalar* x, Scalar* y, Scalar* z) {
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            Vector3 point = points[begin + std::min(j, count - 1)];
+            x[j] = point.x;
+            y[j] = point.y;
+            z[j] = point.z;
+        }
+    };
+
+    /* Extreme point along each direction and largest coordinate, each thread handling a contiguous range of points */
+    extremes.resize(threadsAmount * directionsAmount);
+    projectionMaximums.resize(threadsAmount * directionsAmount);
+    threadMagnitudes.resize(threadsAmount);
+
+    runInParallel(threadsAmount, [this, &getRangeBegin, &loadBlock, directionsAmount](uint thread) {
+        uint* threadExtremes = extremes.data() + thread * directionsAmount;
+        Scalar* maximums = projectionMaximums.data() + thread * directionsAmount;
+
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            threadExtremes[d] = getRangeBegin(thread);
+            maximums[d] = dot(points[threadExtremes[d]], cullingDirections[d]);
+        }
+
+        Scalar x[BLOCK_SIZE];
+        Scalar y[BLOCK_SIZE];
+        Scalar z[BLOCK_SIZE];
+        Scalar projections[BLOCK_SIZE];
+
+        /* Without -ffast-math a floating point maximum is only vectorized lane by lane, so the largest
+         * coordinate is kept per point of the block and the largest projection per SIMD lane, written as
+         * selections since std::max returns a reference */
+        Scalar magnitudes[BLOCK_SIZE] = {};
+        Scalar lanes[LANES];
+
+        for(uint begin = getRangeBegin(thread) ; begin < getRangeBegin(thread + 1) ; begin += BLOCK_SIZE) {
+            uint count = std::min(BLOCK_SIZE, getRangeBegin(thread + 1) - begin);
+            loadBlock(begin, count, x, y, z);
+
+            for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                Scalar coordinate = std::abs(x[j]);
+                coordinate = coordinate < std::abs(y[j]) ? std::abs(y[j]) : coordinate;
+                coordinate = coordinate < std::abs(z[j]) ? std::abs(z[j]) : coordinate;
+                magnitudes[j] = magnitudes[j] < coordinate ? coordinate : magnitudes[j];
+            }
+
+            for(uint d = 0 ; d < directionsAmount ; ++d) {
+                const Vector3& direction = cullingDirections[d];
+
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    projections[j] = direction.x * x[j] + direction.y * y[j] + direction.z * z[j];
+                }
+
+                std::fill(lanes, lanes + LANES, maximums[d]);
+                for(uint j = 0 ; j < BLOCK_SIZE ; j += LANES) {
+                    for(uint k = 0 ; k < LANES ; ++k) {
+                        lanes[k] = lanes[k] < projections[j + k] ? projections[j + k] : lanes[k];
+                    }
+                }
+                Scalar maximum = *std::max_element(lanes, lanes + LANES);
+
+                /* Rarely taken, the block only needs to be searched when it holds a new maximum */
+                if(maximum > maximums[d]) {
+                    uint j = 0;
+                    while(projections[j] != maximum) { ++j; }
+
+                    threadExtremes[d] = begin + j;
+                    maximums[d] = maximum;
+                }
+            }
+        }
+
+        threadMagnitudes[thread] = *std::max_element(magnitudes, magnitudes + BLOCK_SIZE);
+    });
+
+    magnitude = *std::max_element(threadMagnitudes.begin(), threadMagnitudes.end());
+
+    for(uint thread = 1 ; thread < threadsAmount ; ++thread) {
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            uint extreme = extremes[thread * directionsAmount + d];
+            if(dot(points[extreme], cullingDirections[d]) > dot(points[extremes[d]], cullingDirections[d])) {
+                extremes[d] = extreme;
+            }
+        }
+    }
+
+    extremes.resize(directionsAmount);
+    std::sort(extremes.begin(), extremes.end());
+    extremes.erase(std::unique(extremes.begin(), extremes.end()), extremes.end());
+
+    /* Polytope spanned by the extreme points, culling is disabled when they are all in a plane */
+    bool hasVolume = extremes.size() >= 4;
+    if(hasVolume) {
+        if(!polytope) { polytope = std::make_unique<ConvexHull>(); }
+        polytope->points = points;
+        polytope->pointsAmount = pointsAmount;
+        polytope->candidates = extremes;
+        hasVolume = polytope->buildCandidates();
+    }
+
+    if(!hasVolume) {
+        candidates.resize(pointsAmount);
+        std::iota(candidates.begin(), candidates.end(), 0);
+        return;
+    }
+
+    /* The planes are moved outwards by their error bound so rounding never culls a point that is not inside */
+    polytope->getSafePlanes(magnitude, cullingPlanes);
+
+    /* Points inside the polytope are inside the hull, the others are tested by blocks against
+     * every plane so the inner loop has no branch */
+    survivors.resize(threadsAmount);
+
+    runInParallel(threadsAmount, [this, &getRangeBegin, &loadBlock](uint thread) {
+        Scalar x[BLOCK_SIZE];
+        Scalar y[BLOCK_SIZE];
+        Scalar z[BLOCK_SIZE];
+        Scalar distances[BLOCK_SIZE];
+        survivors[thread].clear();
+
+        for(uint begin = getRangeBegin(thread) ; begin < getRangeBegin(thread + 1) ; begin += BLOCK_SIZE) {
+            uint count = std::min(BLOCK_SIZE, getRangeBegin(thread + 1) - begin);
+            loadBlock(begin, count, x, y, z);
+
+            std::fill(distances, distances + BLOCK_SIZE, std::numeric_limits<Scalar>::lowest());
+            for(const Plane<Scalar>& plane : cullingPlanes) {
+                const Vector3& normal = plane.normal;
+                Scalar offset = plane.offset;
+
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    distances[j] = std::max(distances[j], normal.x * x[j] + normal.y * y[j] + normal.z * z[j] - offset);
+                }
+            }
+
+            for(uint j = 0 ; j < count ; ++j) {
+                if(distances[j] >= 0 && !std::binary_search(extremes.begin(), extremes.end(), begin + j)) {
+                    survivors[thread].push_back(begin + j);
+                }
+            }
+        }
+    });
+
+    /* The extreme points are vertices of the hull even if rounding put them slightly inside */
+    candidates.assign(extremes.begin(), extremes.end());
+    for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+        const std::vector<uint>& threadSurvivors = survivors[thread];
+        candidates.insert(candidates.end(), threadSurvivors.begin(), threadSurvivors.end());
+    }
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::reduceCandidates(uint threadsAmount) {
+    const uint candidatesAmount = candidates.size();
+
+    auto getRangeBegin = [candidatesAmount, threadsAmount](uint thread) -> uint {
+        return static_cast<uint64_t>(candidatesAmount) * thread / threadsAmount;
+    };
+
+    /* Bounds of the cloud, each thread handling a contiguous range of candidates */
+    std::vector<Vector3> minimums(threadsAmount, points[candidates[0]]);
+    std::vector<Vector3> maximums(threadsAmount, points[candidates[0]]);
+
+    runInParallel(threadsAmount, [this, &getRangeBegin, &minimums, &maximums](uint thread) {
+        for(uint i = getRangeBegin(thread) ; i < getRangeBegin(thread + 1) ; ++i) {
+            Vector3 point = points[candidates[i]];
+            minimums[thread] = Vector3(std::min(minimums[thread].x, point.x),
+                                    std::min(minimums[thread].y, point.y),
+                                    std::min(minimums[thread].z, point.z));
+            maximums[thread] = Vector3(std::max(maximums[thread].x, point.x),
+                                    std::max(maximums[thread].y, point.y),
+                                    std::max(maximums[thread].z, point.z));
+        }
+    });
+
+    Vector3 minimum = minimums[0];
+    Vector3 maximum = maximums[0];
+    for(uint thread = 1 ; thread < threadsAmount ; ++thread) {
+        minimum = Vector3(std::min(minimum.x, minimums[thread].x),
+                       std::min(minimum.y, minimums[thread].y),
+                       std::min(minimum.z, minimums[thread].z));
+        maximum = Vector3(std::max(maximum.x, maximums[thread].x),
+                       std::max(maximum.y, maximums[thread].y),
+                       std::max(maximum.z, maximums[thread].z));
+    }
+
+    /* The slabs cut the widest axis in equal parts */
+    Vector3 extent = maximum - minimum;
+    Scalar Vector3::* axis = &Vector3::z;
+    if(extent.x >= extent.y && extent.x >= extent.z) {
+        axis = &Vector3::x;
+    } else if(extent.y >= extent.z) {
+        axis = &Vector3::y;
+    }
+
+    Scalar origin = minimum.*axis;
+    Scalar scale = extent.*axis > 0 ? threadsAmount / extent.*axis : 0;
+
+    auto getSlab = [this, axis, origin, scale, threadsAmount](uint index) -> uint {
+        return std::min(static_cast<uint>((points[index].*axis - origin) * scale), threadsAmount - 1);
+    };
+
+    /* Count the candidates of each range falling in each slab, then scatter them so every slab is contiguous */
+    std::vector<uint> offsets(threadsAmount * threadsAmount, 0);
+
+    runInParallel(threadsAmount, [this, &getRangeBegin, &getSlab, &offsets, threadsAmount](uint thread) {
+        for(uint i = getRangeBegin(thread) ; i < getRangeBegin(thread + 1) ; ++i) {
+            ++offsets[getSlab(candidates[i]) * threadsAmount + thread];
+        }
+    });
+
+    std::vector<uint> slabBegins(threadsAmount + 1, 0);
+    uint offset = 0;
+    for(uint slab = 0 ; slab < threadsAmount ; ++slab) {
+        slabBegins[slab] = offset;
+
+        for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+            uint count = offsets[slab * threadsAmount + thread];
+            offsets[slab * threadsAmount + thread] = offset;
+            offset += count;
+        }
+    }
+    slabBegins[threadsAmount] = offset;
+
+    std::vector<uint> slabs(candidatesAmount);
+    runInParallel(threadsAmount, [this, &getRangeBegin, &getSlab, &offsets, &slabs, threadsAmount](uint thread) {
+        for(uint i = getRangeBegin(thread) ; i < getRangeBegin(thread + 1) ; ++i) {
+            slabs[offsets[getSlab(candidates[i]) * threadsAmount + thread]++] = candidates[i];
+        }
+    });
+
+    /* Hull of each slab, slabs too small to have a hull keep all of their points. The hulls are kept so
+     * the next builds reuse their memory */
+    slabVertices.resize(threadsAmount);
+    while(slabHulls.size() < threadsAmount) {
+        slabHulls.push_back(std::make_unique<ConvexHull>());
+    }
+
+    runInParallel(threadsAmount, [this, &slabs, &slabBegins](uint slab) {
+        if(slabBegins[slab + 1] - slabBegins[slab] < MIN_POINTS_PER_SLAB) {
+            slabVertices[slab].assign(slabs.begin() + slabBegins[slab], slabs.begin() + slabBegins[slab + 1]);
+            return;
+        }
+
+        /* Slabs whose points are all in a plane keep them too */
+        ConvexHull& slabHull = *slabHulls[slab];
+        slabHull.points = points;
+        slabHull.pointsAmount = pointsAmount;
+        slabHull.candidates.assign(slabs.begin() + slabBegins[slab], slabs.begin() + slabBegins[slab + 1]);
+
+        if(slabHull.buildCandidates()) {
+            slabVertices[slab] = slabHull.getVertices();
+        } else {
+            slabVertices[slab] = slabHull.candidates;
+        }
+    });
+
+    candidates.clear();
+    for(uint slab = 0 ; slab < threadsAmount ; ++slab) {
+        candidates.insert(candidates.end(), slabVertices[slab].begin(), slabVertices[slab].end());
+    }
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::updateApproximationDirections(Scalar tolerance, uint maxAmount) {
+    if(tolerance == approximationTolerance) { return approximationDirections.size() <= maxAmount; }
+
+    /* The largest angle between a direction of the sphere and the closest of N spiral directions and
+     * opposites is about COVERING_CONSTANT / sqrt(2N), the exact one is measured and N grows until it is small enough */
+    static constexpr double COVERING_CONSTANT = 3.0;
+    const double angle = std::atan(static_cast<double>(tolerance));
+    double estimate = std::ceil(COVERING_CONSTANT * COVERING_CONSTANT / (2.0 * angle * angle));
+    if(estimate > maxAmount) { return false; }
+
+    uint amount = std::max(static_cast<uint>(estimate), 4u);
+    ConvexHull<double> sphere;
+    std::vector<dvec3> sphereDirections;
+
+    while(true) {
+        if(amount > maxAmount) { return false; }
+
+        std::vector<vec3> directions = Directions::hemisphere(amount);
+        sphereDirections.clear();
+        for(const vec3& direction : directions) {
+            dvec3 unit = normalize(dvec3(direction.x, direction.y, direction.z));
+            sphereDirections.push_back(unit);
+            sphereDirections.push_back(unit * -1.0);
+        }
+
+        /* The faces of the hull of the directions are their spherical Delaunay triangles, the largest
+         * angle is the one between the normal of a face and its vertices */
+        sphere.build(sphereDirections);
+        const HalfEdgeMesh& mesh = sphere.getMesh();
+        const PointCloud<double>& cloud = sphere.getCloud();
+        double minimumCosine = 1;
+
+        for(uint i = 0 ; i < mesh.getFacesAmount() ; ++i) {
+            if(mesh.isRemoved(i)) { continue; }
+
+            dvec3 a = cloud.getPoint(mesh.getVertex(i, 0));
+            dvec3 b = cloud.getPoint(mesh.getVertex(i, 1));
+            dvec3 c = cloud.getPoint(mesh.getVertex(i, 2));
+            minimumCosine = std::min(minimumCosine, dot(normalize(cross(b - a, c - a)), a));
+        }
+
+        double tangent = std::sqrt(1 - minimumCosine * minimumCosine) / minimumCosine;
+        if(tangent <= tolerance) {
+            approximationDirections.clear();
+            for(const vec3& direction : directions) {
+                approximationDirections.emplace_back(direction.x, direction.y, direction.z);
+            }
+
+            approximationTolerance = tolerance;
+            approximationTangent = tangent;
+            return true;
+        }
+
+        amount += amount / 8 + 1;
+    }
+}
+
+template<typename Scalar>
+Scalar ConvexHull<Scalar>::reduceToDirectionExtremes(uint threadsAmount) {
+    static constexpr uint BLOCK_SIZE = 64;
+    const uint directionsAmount = approximationDirections.size();
+    const uint candidatesAmount = candidates.size();
+
+    auto getRangeBegin = [candidatesAmount, threadsAmount](uint thread) -> uint {
+        return static_cast<uint64_t>(candidatesAmount) * thread / threadsAmount;
+    };
+
+    /* Candidates the farthest along each direction, at 2d, and along its opposite, at 2d + 1, each
+     * thread handling a contiguous range of candidates */
+    extremes.resize(threadsAmount * 2 * directionsAmount);
+    projectionMaximums.resize(threadsAmount * 2 * directionsAmount);
+
+    runInParallel(threadsAmount, [this, &getRangeBegin, directionsAmount](uint thread) {
+        uint* threadExtremes = extremes.data() + thread * 2 * directionsAmount;
+        Scalar* bounds = projectionMaximums.data() + thread * 2 * directionsAmount;
+
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            threadExtremes[2 * d] = threadExtremes[2 * d + 1] = candidates[getRangeBegin(thread)];
+            bounds[2 * d] = bounds[2 * d + 1] = dot(points[threadExtremes[2 * d]], approximationDirections[d]);
+        }
+
+        Scalar x[BLOCK_SIZE];
+        Scalar y[BLOCK_SIZE];
+        Scalar z[BLOCK_SIZE];
+        std::vector<Scalar> blockMaximums(directionsAmount);
+        std::vector<Scalar> blockMinimums(directionsAmount);
+
+        /* The kernel rounds differently, so a block holding a new bound is searched again for the point
+         * whose projection is the largest without SIMD */
+        auto findExtreme = [&x, &y, &z](const Vector3& direction, uint count) -> uint {
+            uint extreme = 0;
+            for(uint j = 1 ; j < count ; ++j) {
+                if(direction.x * x[j] + direction.y * y[j] + direction.z * z[j] > direction.x * x[extreme] + direction.y * y[extreme] + direction.z * z[extreme]) {
+                    extreme = j;
+                }
+            }
+
+            return extreme;
+        };
+
+        for(uint begin = getRangeBegin(thread) ; begin < getRangeBegin(thread + 1) ; begin += BLOCK_SIZE) {
+            uint count = std::min(BLOCK_SIZE, getRangeBegin(thread + 1) - begin);
+            for(uint j = 0 ; j < count ; ++j) {
+                Vector3 point = points[candidates[begin + j]];
+                x[j] = point.x;
+                y[j] = point.y;
+                z[j] = point.z;
+            }
+
+            Kernels::projectionBounds(x, y, z, count, approximationDirections.data(), directionsAmount, blockMaximums.data(), blockMinimums.data());
+
+            /* Rarely taken once the bounds are close to the hull */
+            for(uint d = 0 ; d < directionsAmount ; ++d) {
+                if(blockMaximums[d] > bounds[2 * d]) {
+                    threadExtremes[2 * d] = candidates[begin + findExtreme(approximationDirections[d], count)];
+                    bounds[2 * d] = blockMaximums[d];
+                }
+
+                if(blockMinimums[d] < bounds[2 * d + 1]) {
+                    threadExtremes[2 * d + 1] = candidates[begin + findExtreme(approximationDirections[d] * Scalar(-1), count)];
+                    bounds[2 * d + 1] = blockMinimums[d];
+                }
+            }
+        }
+    });
+
+    for(uint thread = 1 ; thread < threadsAmount ; ++thread) {
+        const Scalar* bounds = projectionMaximums.data() + thread * 2 * directionsAmount;
+
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            if(bounds[2 * d] > projectionMaximums[2 * d]) {
+                extremes[2 * d] = extremes[thread * 2 * directionsAmount + 2 * d];
+                projectionMaximums[2 * d] = bounds[2 * d];
+            }
+
+            if(bounds[2 * d + 1] < projectionMaximums[2 * d + 1]) {
+                extremes[2 * d + 1] = extremes[thread * 2 * directionsAmount + 2 * d + 1];
+                projectionMaximums[2 * d + 1] = bounds[2 * d + 1];
+            }
+        }
+    }
+
+    Scalar width = 0;
+    for(uint d = 0 ; d < directionsAmount ; ++d) {
+        width = std::max(width, projectionMaximums[2 * d] - projectionMaximums[2 * d + 1]);
+    }
+
+    candidates.assign(extremes.begin(), extremes.begin() + 2 * directionsAmount);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    return width;
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::initialize() {
+    mesh.clear();
+    conflicts.clear();
+    planes.clear();
+    planeBounds.clear();
+    verticesAmount = 0;
+
+    const uint cloudSize = cloud.getSize();
+    if(cloudSize < 4) { return false; }
+
+    const Scalar* x = cloud.getX();
+    const Scalar* y = cloud.getY();
+    const Scalar* z = cloud.getZ();
+
+    /* Smallest and largest point along each axis */
+    uint axisExtremes[6] = { 0, 0, 0, 0, 0, 0 };
+    for(uint i = 1 ; i < cloudSize ; ++i) {
+        if(x[i] < x[axisExtremes[0]]) { axisExtremes[0] = i; }
+        if(x[i] > x[axisExtremes[1]]) { axisExtremes[1] = i; }
+        if(y[i] < y[axisExtremes[2]]) { axisExtremes[2] = i; }
+        if(y[i] > y[axisExtremes[3]]) { axisExtremes[3] = i; }
+        if(z[i] < z[axisExtremes[4]]) { axisExtremes[4] = i; }
+        if(z[i] > z[axisExtremes[5]]) { axisExtremes[5] = i; }
+    }
+
+    /* The two extremes that are the farthest apart are the first edge, there is none when all the points are equal */
+    uint A = axisExtremes[0];
+    uint B = axisExtremes[1];
+    Scalar widest = 0;
+
+    for(uint i = 0 ; i < 6 ; ++i) {
+        for(uint j = i + 1 ; j < 6 ; ++j) {
+            Vector3 edge = cloud.getPoint(axisExtremes[j]) - cloud.getPoint(axisExtremes[i]);
+            if(dot(edge, edge) > widest) {
+                A = axisExtremes[i];
+                B = axisExtremes[j];
+                widest = dot(edge, edge);
+            }
+        }
+    }
+
+    if(widest == 0) { return false; }
+
+    /* The point the farthest from the line of the edge, the squared length of the cross product being
+     * its distance scaled by the length of the edge */
+    const Vector3 a = cloud.getPoint(A);
+    const Vector3 b = cloud.getPoint(B);
+    const Vector3 edge = b - a;
+    uint C = A;
+    Scalar farthest = 0;
+
+    for(uint i = 0 ; i < cloudSize ; ++i) {
+        Vector3 normal = cross(edge, Vector3(x[i], y[i], z[i]) - a);
+        if(dot(normal, normal) > farthest) {
+            C = i;
+            farthest = dot(normal, normal);
+        }
+    }
+
+    if(farthest == 0) { return false; }
+
+    /* The point the farthest from the plane of the triangle */
+    const Vector3 c = cloud.getPoint(C);
+    const Vector3 normal = cross(edge, c - a);
+    const Scalar offset = dot(normal, a);
+    uint D = A;
+    farthest = 0;
+
+    for(uint i = 0 ; i < cloudSize ; ++i) {
+        Scalar distance = std::abs(normal.x * x[i] + normal.y * y[i] + normal.z * z[i] - offset);
+        if(distance > farthest) {
+            D = i;
+            farthest = distance;
+        }
+    }
+
+    /* Rounding cannot tell whether the points are coplanar, the exact predicate searches one that is not */
+    if(farthest <= Predicates::getPlaneErrorBound(a, b, c, magnitude)) {
+        D = UINT_MAX;
+        for(uint i = 0 ; i < cloudSize && D == UINT_MAX ; ++i) {
+            if(Predicates::orientation(a, b, c, cloud.getPoint(i)) != 0.0) { D = i; }
+        }
+
+        if(D == UINT_MAX) { return false; }
+    }
+
+    /* The windings of the four faces all follow from the exact side of D, so they agree even when the
+     * tetrahedron is too flat for any rounded point to be inside it */
+    double side = Predicates::orientation(a, b, c, cloud.getPoint(D));
+    if(side == 0.0) { return false; }
+
+    if(side > 0.0) {
+        addFace(A, C, B);
+        addFace(A, B, D);
+        addFace(B, C, D);
+        addFace(C, A, D);
+    } else {
+        addFace(A, B, C);
+        addFace(A, D, B);
+        addFace(B, D, C);
+        addFace(C, D, A);
+    }
+    verticesAmount = 4;
+
+    for(uint edge = 0 ; edge < 12 ; ++edge) {
+        for(uint twin = edge + 1 ; twin < 12 ; ++twin) {
+            if(mesh.getOrigin(edge) == mesh.getDestination(twin) && mesh.getOrigin(twin) == mesh.getDestination(edge)) {
+                mesh.link(edge, twin);
+            }
+        }
+    }
+
+    /* Each point goes to the first face it is above, points that are above no face are inside the hull */
+    orphans.clear();
+    for(uint i = 0 ; i < cloudSize ; ++i) {
+        if(i != A && i != B && i != C && i != D) { orphans.push_back(i); }
+    }
+
+    for(uint j = 0 ; j < 4 && !orphans.empty() ; ++j) {
+        assignPoints(j);
+    }
+
+    return true;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::addPoint(uint face, uint apex) {
+    const Vector3 apexPoint = cloud.getPoint(apex);
+
+    /* A face is visible when its mark equals the current epoch, so no mark has to be cleared. Marks are
+     * kept between builds since older epochs are always smaller */
+    if(++epoch == 0) {
+        std::fill(faceMarks.begin(), faceMarks.end(), 0);
+        epoch = 1;
+    }
+    faceMarks.resize(mesh.getFacesAmount(), 0);
+
+    /* Flood fill the faces the apex can see and remember one edge leading to a hidden face */
+    stack.clear();
+    visible.clear();
+    uint firstHorizonEdge = HalfEdgeMesh::NONE;
+
+    stack.push_back(face);
+    visible.push_back(face);
+    faceMarks[face] = epoch;
+
+    while(!stack.empty()) {
+        uint current = stack.back();
+        stack.pop_back();
+
+        for(uint k = 0 ; k < 3 ; ++k) {
+            uint neighbour = mesh.getNeighbour(current, k);
+            if(faceMarks[neighbour] == epoch) { continue; }
+
+            if(isAbove(neighbour, apexPoint)) {
+                visible.push_back(neighbour);
+                stack.push_back(neighbour);
+                faceMarks[neighbour] = epoch;
+            } else if(firstHorizonEdge == HalfEdgeMesh::NONE) {
+                firstHorizonEdge = mesh.getEdge(current, k);
+            }
+        }
+    }
+
+    /* Walk the horizon loop by turning around the end vertex of each horizon edge through the visible faces */
+    horizon.clear();
+    uint edge = firstHorizonEdge;
+    do {
+        horizon.push_back(edge);
+
+        edge = mesh.getNext(edge);
+        while(faceMarks[mesh.getFace(mesh.getTwin(edge))] == epoch) {
+            edge = mesh.getNext(mesh.getTwin(edge));
+        }
+    } while(edge != firstHorizonEdge);
+
+    /* The visible faces are a disk whose inner vertices are removed, by Euler's formula there are
+     * (faces - horizon edges + 2) / 2 of them */
+    verticesAmount += 1;
+    verticesAmount -= (visible.size() + 2 - horizon.size()) / 2;
+
+    /* Delete the visible faces and keep their points so they can be handed over to the new faces */
+    orphans.clear();
+    for(uint removed : visible) {
+        mesh.removeFace(removed);
+
+        ConflictList& list = conflicts[removed];
+        for(uint i = 0 ; i < list.size ; ++i) {
+            if(list.points[i] != apex) { orphans.push_back(list.points[i]); }
+        }
+
+        arena.release(list.points, list.size);
+        list = ConflictList{ nullptr, 0, 0 };
+    }
+
+    /* Cone of new faces between the horizon and the apex, keeping the orientation of the deleted faces */
+    uint firstNewFace = mesh.getFacesAmount();
+    for(uint k = 0 ; k < horizon.size() ; ++k) {
+        uint newFace = addFace(mesh.getOrigin(horizon[k]), mesh.getDestination(horizon[k]), apex);
+
+        mesh.link(mesh.getEdge(newFace, 0), mesh.getTwin(horizon[k]));
+        if(k > 0) { mesh.link(mesh.getEdge(newFace, 2), mesh.getEdge(newFace - 1, 1)); }
+    }
+    mesh.link(mesh.getEdge(firstNewFace, 2), mesh.getEdge(mesh.getFacesAmount() - 1, 1));
+
+    for(uint j = firstNewFace ; j < mesh.getFacesAmount() && !orphans.empty() ; ++j) {
+        assignPoints(j);
+    }
+}
+
+template<typename Scalar>
+uint ConvexHull<Scalar>::addFace(uint A, uint B, uint C) {
+    uint face = mesh.addFace(A, B, C);
+    conflicts.push_back(ConflictList{ nullptr, 0, 0 });
+
+    Vector3 a = cloud.getPoint(A);
+    Vector3 b = cloud.getPoint(B);
+    Vector3 c = cloud.getPoint(C);
+    Vector3 normal = cross(b - a, c - a);
+    planes.push_back(Plane<Scalar>{ normal, dot(normal, a) });
+    planeBounds.push_back(Predicates::getPlaneErrorBound(a, b, c, magnitude));
+
+    return face;
+}
+
+template<typename Scalar>
+void ConvexHull<Scalar>::assignPoints(uint face) {
+    distances.resize(orphans.size());
+    uint farthest = Kernels::distances(cloud, orphans.data(), orphans.size(), planes[face], distances.data());
+
+    /* Only the distances too close to zero for their sign to be certain are checked with the exact predicate */
+    const Scalar bound = planeBounds[face];
+
+    /* The farthest point is the next apex of the face. When its distance is within the bound, all the
+     * points of the list are about as close to the plane and the first one is picked */
+    ConflictList& list = conflicts[face];
+    const uint newFarthest = distances[farthest] > bound ? orphans[farthest] : UINT_MAX;
+    const Scalar newFarthestDistance = distances[farthest];
+
+    uint above = 0;
+    for(uint i = 0 ; i < orphans.size() ; ++i) {
+        if(std::abs(distances[i]) <= bound) {
+            distances[i] = isAboveExactly(face, cloud.getPoint(orphans[i])) ? 1 : 0;
+        }
+        if(distances[i] > 0) { ++above; }
+    }
+
+    /* Faces left with points by a vertex budget keep them when more points are inserted */
+    if(list.size > 0) {
+        if(above == 0) { return; }
+
+        const Plane<Scalar>& plane = planes[face];
+        if(newFarthest != UINT_MAX && newFarthestDistance > dot(plane.normal, cloud.getPoint(list.farthest)) - plane.offset) {
+            list.farthest = newFarthest;
+        }
+    } else {
+        list.farthest = newFarthest;
+    }
+
+    /* The list gets all its points at once so it is allocated with its exact size */
+    uint* previous = list.points;
+    list.points = arena.allocate<uint>(list.size + above);
+    std::copy_n(previous, list.size, list.points);
+    arena.release(previous, list.size);
+
+    uint remaining = 0;
+    for(uint i = 0 ; i < orphans.size() ; ++i) {
+        if(distances[i] > 0) {
+            list.points[list.size++] = orphans[i];
+        } else {
+            orphans[remaining++] = orphans[i];
+        }
+    }
+
+    orphans.resize(remaining);
+    if(list.farthest == UINT_MAX && list.size > 0) { list.farthest = list.points[0]; }
+}
+
+template<typename Scalar>
+uint ConvexHull<Scalar>::getFarthestPoint(uint face) const {
+    return conflicts[face].farthest;
+}
+
+template<typename Scalar>
+Scalar ConvexHull<Scalar>::calculatePlaneErrorBound(uint face) const {
+    return Predicates::getPlaneErrorBound(cloud.getPoint(mesh.getVertex(face, 0)), cloud.getPoint(mesh.getVertex(face, 1)),
+                                          cloud.getPoint(mesh.getVertex(face, 2)), magnitude);
+}
+
+template<typename Scalar>
+Plane<Scalar> ConvexHull<Scalar>::getSafePlane(uint face, Scalar pointsMagnitude) const {
+    Plane<Scalar> plane = planes[face];
+    plane.offset -= Predicates::getPlaneErrorBound(cloud.getPoint(mesh.getVertex(face, 0)), cloud.getPoint(mesh.getVertex(face, 1)),
+                                                   cloud.getPoint(mesh.getVertex(face, 2)), pointsMagnitude);
+
+    return plane;
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::isAbove(uint face, const Vector3& point) const {
+    const Plane<Scalar>& plane = planes[face];
+    Scalar distance = dot(plane.normal, point) - plane.offset;
+
+    if(distance > planeBounds[face]) { return true; }
+    if(distance < -planeBounds[face]) { return false; }
+
+    return isAboveExactly(face, point);
+}
+
+template<typename Scalar>
+bool ConvexHull<Scalar>::isAboveExactly(uint face, const Vector3& point) const {
+    return Predicates::orientation(cloud.getPoint(mesh.getVertex(face, 0)), cloud.getPoint(mesh.getVertex(face, 1)),
+                                   cloud.getPoint(mesh.getVertex(face, 2)), point) > 0.0;
+}
@@ -0,0 +1,148 @@
+/***************************************************************************************************
+ * @file  HalfEdgeMesh.hpp
+ * @brief Declaration of the HalfEdgeMesh class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <climits>
+#include <vector>
+#include <sys/types.h>
+
+/**
+ * @class HalfEdgeMesh
+ * @brief Triangle mesh stored as half-edges in flat index arrays. The half-edges of face f are 3f,
+ * 3f + 1 and 3f + 2, so the next half-edge and the face of a half-edge are deduced from its index and
+ * only the origin and the twin of every half-edge are stored.
+ */
+class HalfEdgeMesh {
+public:
+    static constexpr uint NONE = UINT_MAX; ///< Index used for a missing half-edge or face.
+
+    /**
+     * @brief Constructs an empty mesh.
+     */
+    HalfEdgeMesh();
+
+    /**
+     * @brief Removes every face while keeping the allocated memory.
+     */
+    void clear();
+
+    /**
+     * @brief Adds a face. Its half-edges go from A to B, from B to C and from C to A and have no twin.
+     * @param A, B, C The face's vertices, in counter-clockwise order seen from the outside.
+     * @return The index of the new face.
+     */
+    uint addFace(uint A, uint B, uint C);
+
+    /**
+     * @brief Marks a face as removed. Its half-edges keep their data until the mesh is compacted.
+     * @param face The face's index, of a face that is not removed yet.
+     */
+    void removeFace(uint face);
+
+    /**
+     * @brief Drops the removed faces and moves the others to the beginning, in the same order. The faces
+     * that are not removed must only have twins among themselves.
+     * @param faces Replaced by the new index of each face, NONE for the removed ones.
+     */
+    void compact(std::vector<uint>& faces);
+
+    /**
+     * @brief Makes two half-edges twins of one another.
+     * @param edge, twin The half-edges' indices.
+     */
+    void link(uint edge, uint twin);
+
+    /**
+     * @brief Getter for the amount of face slots, removed faces included.
+     * @return The amount of faces that were added since the last clear, and kept by the last compaction.
+     */
+    uint getFacesAmount() const;
+
+    /**
+     * @brief Getter for the removedAmount member.
+     * @return The amount of face slots of removed faces.
+     */
+    uint getRemovedAmount() const;
+
+    /**
+     * @brief Whether a face was removed.
+     * @param face The face's index.
+     * @return Whether the face was removed.
+     */
+    bool isRemoved(uint face) const;
+
+    /**
+     * @brief Getter for one of the half-edges of a face.
+     * @param face The face's index.
+     * @param k The half-edge's position in the face, between 0 and 2.
+     * @return The half-edge's index.
+     */
+    uint getEdge(uint face, uint k) const;
+
+    /**
+     * @brief Getter for one of the vertices of a face.
+     * @param face The face's index.
+     * @param k The vertex's position in the face, between 0 and 2.
+     * @return The vertex's index.
+     */
+    uint getVertex(uint face, uint k) const;
+
+    /**
+     * @brief Getter for the face on the other side of one of the edges of a face.
+     * @param face The face's index.
+     * @param k The edge's position in the face, between 0 and 2.
+     * @return The neighbouring face's index or NONE if the edge has no twin.
+     */
+    uint getNeighbour(uint face, uint k) const;
+
+    /**
+     * @brief Getter for the face a half-edge belongs to.
+     * @param edge The half-edge's index.
+     * @return The face's index.
+     */
+    uint getFace(uint edge) const;
+
+    /**
+     * @brief Getter for the next half-edge in the same face.
+     * @param edge The half-edge's index.
+     * @return The next half-edge's index.
+     */
+    uint getNext(uint edge) const;
+
+    /**
+     * @brief Getter for the previous half-edge in the same face.
+     * @param edge The half-edge's index.
+     * @return The previous half-edge's index.
+     */
+    uint getPrevious(uint edge) const;
+
+    /**
+     * @brief Getter for the twin of a half-edge.
+     * @param edge The half-edge's index.
+     * @return The twin's index or NONE if the half-edge has no twin.
+     */
+    uint getTwin(uint edge) const;
+
+    /**
+     * @brief Getter for the vertex a half-edge starts from.
+     * @param edge The half-edge's index.
+     * @return The vertex's index.
+     */
+    uint getOrigin(uint edge) const;
+
+    /**
+     * @brief Getter for the vertex a half-edge goes to.
+     * @param edge The half-edge's index.
+     * @return The vertex's index.
+     */
+    uint getDestination(uint edge) const;
+
+private:
+    std::vector<uint> origins; ///< The vertex each half-edge starts from.
+    std::vector<uint> twins;   ///< The twin of each half-edge.
+    std::vector<bool> removed; ///< Whether each face was removed.
+    uint removedAmount;        ///< The amount of removed faces.
+};
@@ -0,0 +1,125 @@
+/***************************************************************************************************
+ * @file  KineticHull.hpp
+ * @brief Declaration of the KineticHull class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <sys/types.h>
+#include "hull/ConvexHull.hpp"
+#include "hull/directions.hpp"
+#include "hull/kernels.hpp"
+#include "hull/PointView.hpp"
+
+/**
+ * @class KineticHull
+ * @brief Computes the convex hull of points that move a little between updates. Each update rebuilds the
+ * hull from the vertices of the previous one at their new positions and from the few points that may
+ * be outside of them. A point is known to be inside the hull while it has not moved more than half its depth
+ * in the hull, counting the motion of the hull's vertices. Only the points whose margin is used up are
+ * tested again, so the cost of an update is mostly one pass over the points and the build of a hull of
+ * about as many points as the hull has vertices.
+ * @tparam Scalar The type of the coordinates, float or double.
+ */
+template<typename Scalar>
+class KineticHull {
+public:
+    using Vector3 = tvec3<Scalar>; ///< The type of the points.
+
+    /**
+     * @brief Constructs an empty hull.
+     * @param threadsAmount The amount of threads of the full builds, 0 for as many as the hardware supports.
+     */
+    explicit KineticHull(uint threadsAmount = 0);
+
+    /**
+     * @brief Updates the hull to the new positions of the points. The first update, and any update
+     * with another amount of points, is a full build.
+     * @param points The points, the same ones in the same order as in the last update.
+     */
+    void update(const std::vector<Vector3>& points);
+
+    /**
+     * @brief Updates the hull to the new positions of the points read through a view.
+     * @param points The view, whose memory must stay valid during the update.
+     */
+    void update(const PointView<Scalar>& points);
+
+    /**
+     * @brief Forgets the previous updates so the next one is a full build.
+     */
+    void reset();
+
+    /**
+     * @brief Getter for the hull member.
+     * @return The hull of the last update, whose vertex indices are indices in the updated points.
+     */
+    const ConvexHull<Scalar>& getHull() const;
+
+    /**
+     * @brief Getter for the testedAmount member.
+     * @return The amount of points the last update tested against the inscribed polytope.
+     */
+    uint getTestedAmount() const;
+
+private:
+    static constexpr double EXPIRED = -std::numeric_limits<double>::infinity(); ///< The margin of the points that have to be tested.
+    static constexpr double VERTEX = std::numeric_limits<double>::infinity();   ///< The margin of the hull's vertices, which are always rebuilt from.
+    static constexpr uint MAX_TESTED_VERTICES = 512; ///< The most vertices of a hull the points are tested against.
+
+    /**
+     * @brief Finds the previous vertices that are the farthest along the lattice directions. Their
+     * polytope is inside the hull and has few faces.
+     */
+    void findExtremeVertices();
+
+    /**
+     * @brief Picks the previous vertices, or MAX_TESTED_VERTICES of them evenly spread in their list when
+     * there are more.
+     */
+    void sampleVertices();
+
+    /**
+     * @brief Builds the polytope of the polytopeVertices member.
+     * @param points The points.
+     * @return Whether the vertices span a volume.
+     */
+    bool buildPolytope(const PointView<Scalar>& points);
+
+    /**
+     * @brief Tests the expired points against the planes member. The points that are below all of them get
+     * a margin of half their distance to the closest one, the others stay in the expired member.
+     * @param pointsMagnitude The largest absolute value of the coordinates of the points.
+     */
+    void testPoints(Scalar pointsMagnitude);
+
+    /**
+     * @brief Replaces the vertices of the hull. The previous vertices have to be tested by the next
+     * update and the new ones are not tested.
+     */
+    void updateVertices();
+
+    uint threadsAmount; ///< The amount of threads of the full builds.
+    uint testedAmount;  ///< The amount of points the last update tested.
+
+    ConvexHull<Scalar> hull;         ///< The hull of the last update.
+    ConvexHull<Scalar> polytope;     ///< A polytope inside the hull the points are tested against.
+    std::vector<Plane<Scalar>> planes; ///< The safe planes of the polytope, normalized by the tests.
+    std::vector<Vector3> directions; ///< The directions the extreme vertices are the farthest along.
+
+    std::vector<Vector3> positions; ///< The positions of the points at the last update.
+    std::vector<double> margins;    ///< The motion each point can accumulate while staying inside the hull.
+    double motion;                  ///< The largest displacement of a point accumulated over the updates.
+
+    std::vector<uint> vertices;         ///< The vertices of the hull.
+    std::vector<uint> polytopeVertices; ///< The vertices of the polytope.
+    std::vector<uint> expired;          ///< The points whose margin is used up.
+    std::vector<uint> candidates;       ///< The points the hull is rebuilt from.
+};
+
+#include "KineticHull.tpp"
@@ -0,0 +1,226 @@
+/***************************************************************************************************
+ * @file  KineticHull.tpp
+ * @brief Implementation of the KineticHull class
+ **************************************************************************************************/
+
+template<typename Scalar>
+KineticHull<Scalar>::KineticHull(uint threadsAmount) : threadsAmount(threadsAmount), testedAmount(0), motion(0) {
+    for(const vec3& direction : Directions::lattice(26)) {
+        directions.emplace_back(direction.x, direction.y, direction.z);
+    }
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::update(const std::vector<Vector3>& points) {
+    update(PointView<Scalar>(points));
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::update(const PointView<Scalar>& points) {
+    const uint pointsAmount = points.getSize();
+
+    /* Every point is tested by the update after a full build */
+    if(pointsAmount != positions.size() || vertices.empty()) {
+        hull.build(points, threadsAmount);
+
+        positions.resize(pointsAmount);
+        for(uint i = 0 ; i < pointsAmount ; ++i) {
+            positions[i] = points[i];
+        }
+
+        margins.assign(pointsAmount, EXPIRED);
+        motion = 0;
+        testedAmount = 0;
+        vertices.clear();
+        updateVertices();
+        return;
+    }
+
+    /* Largest displacement since the last update, rounded up, and largest coordinate */
+    Scalar displacement = 0;
+    Scalar magnitude = 0;
+
+    for(uint i = 0 ; i < pointsAmount ; ++i) {
+        Vector3 point = points[i];
+        Vector3 offset = point - positions[i];
+        displacement = std::max(displacement, dot(offset, offset));
+        magnitude = std::max(magnitude, std::max(std::abs(point.x), std::max(std::abs(point.y), std::abs(point.z))));
+        positions[i] = point;
+    }
+
+    motion += std::sqrt(static_cast<double>(displacement)) * (1 + 16 * std::numeric_limits<Scalar>::epsilon());
+
+    /* A point at depth d in a polytope whose vertices are points stays inside the hull while neither the
+     * point nor the vertices move more than d / 2. The points whose margin is used up get a new one or are
+     * rebuilt from, with the previous vertices */
+    expired.clear();
+    for(uint i = 0 ; i < pointsAmount ; ++i) {
+        if(margins[i] <= motion) { expired.push_back(i); }
+    }
+    testedAmount = expired.size();
+
+    if(!expired.empty()) {
+        /* The polytope of the extreme vertices has few faces and keeps the deep points */
+        findExtremeVertices();
+        if(buildPolytope(points)) {
+            polytope.getSafePlanes(magnitude, planes);
+            testPoints(magnitude);
+        }
+
+        /* The points close to the surface are tested against the hull of the previous vertices, or of
+         * evenly spread ones when there are too many to test each point against all the faces */
+        if(!expired.empty()) {
+            sampleVertices();
+            if(buildPolytope(points)) {
+                polytope.getSafePlanes(magnitude, planes);
+                testPoints(magnitude);
+            }
+        }
+    }
+
+    candidates = vertices;
+    candidates.insert(candidates.end(), expired.begin(), expired.end());
+
+    try {
+        hull.build(points, candidates);
+    } catch(const std::runtime_error&) {
+        reset();
+        update(points);
+        return;
+    }
+
+    updateVertices();
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::reset() {
+    positions.clear();
+    margins.clear();
+    vertices.clear();
+    motion = 0;
+}
+
+template<typename Scalar>
+const ConvexHull<Scalar>& KineticHull<Scalar>::getHull() const {
+    return hull;
+}
+
+template<typename Scalar>
+uint KineticHull<Scalar>::getTestedAmount() const {
+    return testedAmount;
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::findExtremeVertices() {
+    polytopeVertices.clear();
+
+    for(const Vector3& direction : directions) {
+        uint extreme = vertices[0];
+        Scalar maximum = dot(positions[extreme], direction);
+
+        for(uint vertex : vertices) {
+            Scalar projection = dot(positions[vertex], direction);
+            if(projection > maximum) {
+                extreme = vertex;
+                maximum = projection;
+            }
+        }
+
+        polytopeVertices.push_back(extreme);
+    }
+
+    std::sort(polytopeVertices.begin(), polytopeVertices.end());
+    polytopeVertices.erase(std::unique(polytopeVertices.begin(), polytopeVertices.end()), polytopeVertices.end());
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::sampleVertices() {
+    if(vertices.size() <= MAX_TESTED_VERTICES) {
+        polytopeVertices = vertices;
+        return;
+    }
+
+    polytopeVertices.clear();
+    for(uint i = 0 ; i < MAX_TESTED_VERTICES ; ++i) {
+        polytopeVertices.push_back(vertices[static_cast<uint64_t>(i) * vertices.size() / MAX_TESTED_VERTICES]);
+    }
+}
+
+template<typename Scalar>
+bool KineticHull<Scalar>::buildPolytope(const PointView<Scalar>& points) {
+    if(polytopeVertices.size() < 4) { return false; }
+
+    try {
+        polytope.build(points, polytopeVertices);
+    } catch(const std::runtime_error&) {
+        return false;
+    }
+
+    return true;
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::testPoints(Scalar pointsMagnitude) {
+    static constexpr uint BLOCK_SIZE = 64;
+
+    /* Normalizing rounds the planes again, by less than a few epsilons of the coordinates */
+    for(Plane<Scalar>& plane : planes) {
+        Scalar normalLength = length(plane.normal);
+        plane.normal = plane.normal / normalLength;
+        plane.offset = plane.offset / normalLength;
+    }
+    const Scalar error = 16 * std::numeric_limits<Scalar>::epsilon() * pointsMagnitude;
+
+    /* The end of a partial block repeats its last point so the loops over a block always have the same
+     * length and get vectorized */
+    Scalar x[BLOCK_SIZE];
+    Scalar y[BLOCK_SIZE];
+    Scalar z[BLOCK_SIZE];
+    Scalar depths[BLOCK_SIZE];
+    uint remaining = 0;
+
+    for(uint begin = 0 ; begin < expired.size() ; begin += BLOCK_SIZE) {
+        uint count = std::min<uint>(BLOCK_SIZE, expired.size() - begin);
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            const Vector3& point = positions[expired[begin + std::min(j, count - 1)]];
+            x[j] = point.x;
+            y[j] = point.y;
+            z[j] = point.z;
+        }
+
+        std::fill(depths, depths + BLOCK_SIZE, std::numeric_limits<Scalar>::max());
+        for(const Plane<Scalar>& plane : planes) {
+            const Vector3& normal = plane.normal;
+            Scalar offset = plane.offset;
+
+            for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                depths[j] = std::min(depths[j], offset - normal.x * x[j] - normal.y * y[j] - normal.z * z[j]);
+            }
+        }
+
+        for(uint j = 0 ; j < count ; ++j) {
+            uint point = expired[begin + j];
+            Scalar depth = depths[j] - error;
+
+            if(depth > 0) {
+                margins[point] = motion + depth / 2.0;
+            } else {
+                expired[remaining++] = point;
+            }
+        }
+    }
+
+    expired.resize(remaining);
+}
+
+template<typename Scalar>
+void KineticHull<Scalar>::updateVertices() {
+    for(uint vertex : vertices) {
+        margins[vertex] = EXPIRED;
+    }
+
+    vertices = hull.getVertices();
+    for(uint vertex : vertices) {
+        margins[vertex] = VERTEX;
+    }
+}
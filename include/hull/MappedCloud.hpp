@@ -0,0 +1,71 @@
+/***************************************************************************************************
+ * @file  MappedCloud.hpp
+ * @brief Declaration of the MappedCloud class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <sys/types.h>
+#include "hull/PointView.hpp"
+
+/**
+ * @class MappedCloud
+ * @brief Maps a binary point cloud file in memory so the hull reads its coordinates in place. Supports
+ * raw little-endian float32 x, y, z triplets and binary little-endian PLY files whose vertices have
+ * float or double x, y and z properties. Nothing is read when the file is opened, the pages are loaded
+ * by the first pass over the points.
+ */
+class MappedCloud {
+public:
+    /**
+     * @brief Maps a file. PLY files are recognized by their header, any other file is read as raw float32.
+     * @param path The path of the file.
+     */
+    explicit MappedCloud(const std::string& path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedCloud();
+
+    MappedCloud(const MappedCloud& cloud) = delete;
+    MappedCloud& operator =(const MappedCloud& cloud) = delete;
+
+    /**
+     * @brief Creates a view on the points, valid as long as the cloud exists.
+     * @tparam Scalar The type of the coordinates, which has to be the type stored in the file.
+     * @return The view.
+     */
+    template<typename Scalar>
+    PointView<Scalar> getView() const;
+
+    /**
+     * @brief Getter for the pointsAmount member.
+     * @return The amount of points.
+     */
+    uint getPointsAmount() const;
+
+    /**
+     * @brief Getter for the doublePrecision member.
+     * @return Whether the coordinates are stored as double.
+     */
+    bool isDoublePrecision() const;
+
+private:
+    /**
+     * @brief Reads the header of a PLY file and finds the coordinates of the vertices.
+     */
+    void parsePlyHeader();
+
+    void* memory;       ///< The mapped file.
+    std::size_t size;   ///< The size of the file in bytes.
+
+    const unsigned char* x; ///< The x coordinate of the first point.
+    const unsigned char* y; ///< The y coordinate of the first point.
+    const unsigned char* z; ///< The z coordinate of the first point.
+    std::size_t stride;     ///< The amount of bytes between two consecutive points.
+    uint pointsAmount;      ///< The amount of points.
+    bool doublePrecision;   ///< Whether the coordinates are stored as double.
+};
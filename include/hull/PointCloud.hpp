@@ -0,0 +1,120 @@
+/***************************************************************************************************
+ * @file  PointCloud.hpp
+ * @brief Declaration of the PointCloud class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <sys/types.h>
+#include "hull/PointView.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @struct AlignedAllocator
+ * @brief Allocator returning memory aligned on cache lines so SIMD loads never cross one needlessly.
+ * @tparam Type The type of the allocated elements.
+ */
+template<typename Type>
+struct AlignedAllocator {
+    using value_type = Type;
+
+    static constexpr std::size_t ALIGNMENT = 64; ///< The alignment of every allocation in bytes.
+
+    AlignedAllocator() = default;
+
+    template<typename Other>
+    AlignedAllocator(const AlignedAllocator<Other>&) { }
+
+    Type* allocate(std::size_t count) {
+        std::size_t size = (count * sizeof(Type) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        void* memory = std::aligned_alloc(ALIGNMENT, size);
+        if(memory == nullptr) { throw std::bad_alloc(); }
+
+        return static_cast<Type*>(memory);
+    }
+
+    void deallocate(Type* memory, std::size_t) {
+        std::free(memory);
+    }
+
+    template<typename Other>
+    bool operator ==(const AlignedAllocator<Other>&) const { return true; }
+};
+
+/**
+ * @class PointCloud
+ * @brief Stores points as separate aligned arrays of x, y and z coordinates so kernels can load
+ * several points at once. Each point remembers its index in the cloud it was copied from.
+ * @tparam Scalar The type of the coordinates.
+ */
+template<typename Scalar>
+class PointCloud {
+public:
+    /**
+     * @brief Constructs an empty cloud.
+     */
+    PointCloud();
+
+    /**
+     * @brief Replaces the content of the cloud by a subset of a point array.
+     * @param points The view on the point array.
+     * @param indices The indices of the points to copy, that are remembered as their indices.
+     */
+    void assign(const PointView<Scalar>& points, const std::vector<uint>& indices);
+
+    /**
+     * @brief Adds a point at the end of the cloud.
+     * @param point The point.
+     * @param index The index that is remembered for the point.
+     */
+    void add(const tvec3<Scalar>& point, uint index);
+
+    /**
+     * @brief Getter for the amount of points.
+     * @return The amount of points.
+     */
+    uint getSize() const;
+
+    /**
+     * @brief Getter for a point.
+     * @param point The point's position in the cloud.
+     * @return The point.
+     */
+    tvec3<Scalar> getPoint(uint point) const;
+
+    /**
+     * @brief Getter for the index a point had in the array it was copied from.
+     * @param point The point's position in the cloud.
+     * @return The point's index in the source array.
+     */
+    uint getIndex(uint point) const;
+
+    /**
+     * @brief Getter for the x coordinates.
+     * @return The x coordinates, aligned on AlignedAllocator::ALIGNMENT.
+     */
+    const Scalar* getX() const;
+
+    /**
+     * @brief Getter for the y coordinates.
+     * @return The y coordinates, aligned on AlignedAllocator::ALIGNMENT.
+     */
+    const Scalar* getY() const;
+
+    /**
+     * @brief Getter for the z coordinates.
+     * @return The z coordinates, aligned on AlignedAllocator::ALIGNMENT.
+     */
+    const Scalar* getZ() const;
+
+private:
+    std::vector<Scalar, AlignedAllocator<Scalar>> x; ///< The x coordinate of each point.
+    std::vector<Scalar, AlignedAllocator<Scalar>> y; ///< The y coordinate of each point.
+    std::vector<Scalar, AlignedAllocator<Scalar>> z; ///< The z coordinate of each point.
+    std::vector<uint> indices; ///< The index of each point in the array it was copied from.
+};
+
+#include "PointCloud.tpp"
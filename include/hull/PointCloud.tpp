@@ -0,0 +1,60 @@
+/***************************************************************************************************
+ * @file  PointCloud.tpp
+ * @brief Implementation of the PointCloud class
+ **************************************************************************************************/
+
+template<typename Scalar>
+PointCloud<Scalar>::PointCloud() { }
+
+template<typename Scalar>
+void PointCloud<Scalar>::assign(const PointView<Scalar>& points, const std::vector<uint>& indices) {
+    x.resize(indices.size());
+    y.resize(indices.size());
+    z.resize(indices.size());
+    this->indices = indices;
+
+    for(uint i = 0 ; i < indices.size() ; ++i) {
+        tvec3<Scalar> point = points[indices[i]];
+        x[i] = point.x;
+        y[i] = point.y;
+        z[i] = point.z;
+    }
+}
+
+template<typename Scalar>
+void PointCloud<Scalar>::add(const tvec3<Scalar>& point, uint index) {
+    x.push_back(point.x);
+    y.push_back(point.y);
+    z.push_back(point.z);
+    indices.push_back(index);
+}
+
+template<typename Scalar>
+uint PointCloud<Scalar>::getSize() const {
+    return indices.size();
+}
+
+template<typename Scalar>
+tvec3<Scalar> PointCloud<Scalar>::getPoint(uint point) const {
+    return tvec3<Scalar>(x[point], y[point], z[point]);
+}
+
+template<typename Scalar>
+uint PointCloud<Scalar>::getIndex(uint point) const {
+    return indices[point];
+}
+
+template<typename Scalar>
+const Scalar* PointCloud<Scalar>::getX() const {
+    return x.data();
+}
+
+template<typename Scalar>
+const Scalar* PointCloud<Scalar>::getY() const {
+    return y.data();
+}
+
+template<typename Scalar>
+const Scalar* PointCloud<Scalar>::getZ() const {
+    return z.data();
+}
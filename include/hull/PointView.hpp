@@ -0,0 +1,83 @@
+/***************************************************************************************************
+ * @file  PointView.hpp
+ * @brief Declaration of the PointView class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <sys/types.h>
+#include "maths/vec3.hpp"
+
+/**
+ * @class PointView
+ * @brief Reads points from memory it does not own, whose coordinates are found at a constant stride
+ * from each other. A view on the vertex records of a mapped file lets the hull read them in place.
+ * @tparam Scalar The type of the coordinates.
+ */
+template<typename Scalar>
+class PointView {
+public:
+    /**
+     * @brief Constructs an empty view.
+     */
+    PointView();
+
+    /**
+     * @brief Constructs a view on contiguous points.
+     * @param points The points.
+     * @param size The amount of points.
+     */
+    PointView(const tvec3<Scalar>* points, uint size);
+
+    /**
+     * @brief Constructs a view on a point array.
+     * @tparam Allocator The allocator of the array.
+     * @param points The points, which must outlive the view.
+     */
+    template<typename Allocator>
+    PointView(const std::vector<tvec3<Scalar>, Allocator>& points);
+
+    /**
+     * @brief Constructs a view on coordinates stored at a constant stride. The coordinates do not
+     * need to be aligned.
+     * @param x The x coordinate of the first point.
+     * @param y The y coordinate of the first point.
+     * @param z The z coordinate of the first point.
+     * @param stride The amount of bytes between the coordinates of two consecutive points.
+     * @param size The amount of points.
+     */
+    PointView(const void* x, const void* y, const void* z, std::size_t stride, uint size);
+
+    /**
+     * @brief Reads a point.
+     * @param index The point's index.
+     * @return The point.
+     */
+    tvec3<Scalar> operator [](uint index) const;
+
+    /**
+     * @brief Getter for the size member.
+     * @return The amount of points.
+     */
+    uint getSize() const;
+
+private:
+    /**
+     * @brief Reads a coordinate that may not be aligned.
+     * @param coordinates The coordinate of the first point.
+     * @param index The point's index.
+     * @return The coordinate.
+     */
+    Scalar load(const unsigned char* coordinates, uint index) const;
+
+    const unsigned char* x; ///< The x coordinate of the first point.
+    const unsigned char* y; ///< The y coordinate of the first point.
+    const unsigned char* z; ///< The z coordinate of the first point.
+    std::size_t stride;     ///< The amount of bytes between two consecutive points.
+    uint size;              ///< The amount of points.
+};
+
+#include "PointView.tpp"
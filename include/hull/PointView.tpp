@@ -0,0 +1,39 @@
+/***************************************************************************************************
+ * @file  PointView.tpp
+ * @brief Implementation of the PointView class
+ **************************************************************************************************/
+
+template<typename Scalar>
+PointView<Scalar>::PointView() : x(nullptr), y(nullptr), z(nullptr), stride(0), size(0) { }
+
+template<typename Scalar>
+PointView<Scalar>::PointView(const tvec3<Scalar>* points, uint size)
+    : PointView(reinterpret_cast<const unsigned char*>(points) + offsetof(tvec3<Scalar>, x),
+                reinterpret_cast<const unsigned char*>(points) + offsetof(tvec3<Scalar>, y),
+                reinterpret_cast<const unsigned char*>(points) + offsetof(tvec3<Scalar>, z), sizeof(tvec3<Scalar>), size) { }
+
+template<typename Scalar>
+template<typename Allocator>
+PointView<Scalar>::PointView(const std::vector<tvec3<Scalar>, Allocator>& points) : PointView(points.data(), points.size()) { }
+
+template<typename Scalar>
+PointView<Scalar>::PointView(const void* x, const void* y, const void* z, std::size_t stride, uint size)
+    : x(static_cast<const unsigned char*>(x)), y(static_cast<const unsigned char*>(y)),
+      z(static_cast<const unsigned char*>(z)), stride(stride), size(size) { }
+
+template<typename Scalar>
+tvec3<Scalar> PointView<Scalar>::operator [](uint index) const {
+    return tvec3<Scalar>(load(x, index), load(y, index), load(z, index));
+}
+
+template<typename Scalar>
+uint PointView<Scalar>::getSize() const {
+    return size;
+}
+
+template<typename Scalar>
+Scalar PointView<Scalar>::load(const unsigned char* coordinates, uint index) const {
+    Scalar coordinate;
+    std::memcpy(&coordinate, coordinates + static_cast<std::size_t>(index) * stride, sizeof(Scalar));
+    return coordinate;
+}
@@ -0,0 +1,98 @@
+/***************************************************************************************************
+ * @file  StreamingHull.hpp
+ * @brief Declaration of the StreamingHull class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include "hull/ConvexHull.hpp"
+
+/**
+ * @class StreamingHull
+ * @brief Computes the convex hull of a point cloud that does not fit in memory. The points are read by
+ * chunks that are folded in a running hull one after the other : the hull of a chunk and of the running
+ * hull's vertices replaces the running hull. Only the hull's vertices and one chunk are in memory at any
+ * time.
+ * @tparam Scalar The type of the coordinates, float or double.
+ */
+template<typename Scalar>
+class StreamingHull {
+public:
+    using Vector3 = tvec3<Scalar>; ///< The type of the points.
+
+    /**
+     * @brief Reads the next points of the input.
+     * @param points The buffer the points are written to.
+     * @param capacity The largest amount of points the buffer can hold.
+     * @return The amount of points read, 0 once the input is exhausted.
+     */
+    using Reader = std::function<uint64_t(Vector3* points, uint64_t capacity)>;
+
+    static constexpr uint64_t DEFAULT_CHUNK_SIZE = 1 << 22; ///< The least amount of points read at once by default.
+
+    /**
+     * @brief Constructs an empty hull.
+     * @param chunkSize The least amount of points read at once. Chunks are as large as the running hull
+     * when it has more vertices, so the work of each fold is mostly spent on new points.
+     * @param threadsAmount The amount of threads each fold uses, 0 for as many as the hardware supports.
+     */
+    explicit StreamingHull(uint64_t chunkSize = DEFAULT_CHUNK_SIZE, uint threadsAmount = 0);
+
+    /**
+     * @brief Computes the convex hull of the points given by a reader, until it returns 0.
+     * @param read The reader. Needs at least 4 points that are not coplanar in total.
+     */
+    void build(const Reader& read);
+
+    /**
+     * @brief Computes the convex hull of the points of a stream of raw little-endian float32 x, y, z triplets.
+     * @param stream The stream, read until its end.
+     */
+    void build(std::istream& stream);
+
+    /**
+     * @brief Getter for the points member.
+     * @return The coordinates of the hull's vertices, in no particular order.
+     */
+    const std::vector<Vector3>& getVertices() const;
+
+    /**
+     * @brief Lists the faces of the hull.
+     * @return The indices in getVertices of the vertices of each face, 3 per face, in counter-clockwise
+     * order seen from the outside.
+     */
+    std::vector<uint> getTriangles() const;
+
+    /**
+     * @brief Getter for the pointsAmount member.
+     * @return The amount of points read by the last build.
+     */
+    uint64_t getPointsAmount() const;
+
+private:
+    /**
+     * @brief Replaces the running hull by the hull of its vertices and of the points read after them, and
+     * moves the new vertices to the beginning of the points.
+     * @return Whether the points span a volume. When they do not, they are all kept as they are.
+     */
+    bool fold();
+
+    uint64_t chunkSize;     ///< The least amount of points read at once.
+    uint threadsAmount;     ///< The amount of threads each fold uses.
+    uint64_t pointsAmount;  ///< The amount of points read since the build started.
+    uint verticesAmount;    ///< The amount of vertices at the beginning of the points, or of points read while they span no volume.
+
+    std::vector<Vector3> points; ///< The running hull's vertices followed by the chunk being read.
+    ConvexHull<Scalar> hull;     ///< The last fold's hull.
+};
+
+#include "StreamingHull.tpp"
@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * @file  StreamingHull.tpp
+ * @brief Implementation of the StreamingHull class
+ **************************************************************************************************/
+
+template<typename Scalar>
+StreamingHull<Scalar>::StreamingHull(uint64_t chunkSize, uint threadsAmount)
+    : chunkSize(chunkSize), threadsAmount(threadsAmount), pointsAmount(0), verticesAmount(0) {
+    if(chunkSize == 0 || chunkSize > UINT_MAX / 4) {
+        throw std::runtime_error("The chunk size must be between 1 and " + std::to_string(UINT_MAX / 4) + ".");
+    }
+}
+
+template<typename Scalar>
+void StreamingHull<Scalar>::build(const Reader& read) {
+    pointsAmount = 0;
+    verticesAmount = 0;
+    points.clear();
+
+    bool built = false;
+
+    while(true) {
+        /* Reading at least as many points as the hull has vertices keeps the total work of the folds
+         * proportional to the amount of points, even when most of them are vertices */
+        uint64_t capacity = std::max<uint64_t>(chunkSize, verticesAmount);
+        if(verticesAmount + capacity > UINT_MAX) {
+            throw std::runtime_error("The hull has too many vertices to be indexed.");
+        }
+
+        points.resize(verticesAmount + capacity);
+        uint64_t count = read(points.data() + verticesAmount, capacity);
+        if(count == 0) { break; }
+
+        points.resize(verticesAmount + count);
+        pointsAmount += count;
+
+        /* The points are all kept until they span a volume, a flat beginning of the input does not end the build */
+        if(fold()) { built = true; }
+    }
+
+    points.resize(verticesAmount);
+    points.shrink_to_fit();
+
+    if(!built) {
+        throw std::runtime_error("The hull needs at least 4 points that are not coplanar.");
+    }
+
+    /* The last fold indexed the vertices before they were moved, the hull of the vertices alone is the
+     * same and its indices are positions in the vertices */
+    hull.build(points, threadsAmount);
+}
+
+template<typename Scalar>
+void StreamingHull<Scalar>::build(std::istream& stream) {
+    if constexpr(std::endian::native != std::endian::little) {
+        throw std::runtime_error("Raw float32 streams can only be read on little-endian machines.");
+    }
+
+    std::vector<float> coordinates;
+
+    build([&stream, &coordinates](Vector3* points, uint64_t capacity) -> uint64_t {
+        coordinates.resize(3 * capacity);
+        stream.read(reinterpret_cast<char*>(coordinates.data()), coordinates.size() * sizeof(float));
+
+        uint64_t bytes = stream.gcount();
+        if(bytes % (3 * sizeof(float)) != 0) {
+            throw std::runtime_error("The stream ends in the middle of a point.");
+        }
+
+        uint64_t count = bytes / (3 * sizeof(float));
+        for(uint64_t i = 0 ; i < count ; ++i) {
+            points[i] = Vector3(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+        }
+
+        return count;
+    });
+}
+
+template<typename Scalar>
+const std::vector<typename StreamingHull<Scalar>::Vector3>& StreamingHull<Scalar>::getVertices() const {
+    return points;
+}
+
+template<typename Scalar>
+std::vector<uint> StreamingHull<Scalar>::getTriangles() const {
+    return hull.getTriangles();
+}
+
+template<typename Scalar>
+uint64_t StreamingHull<Scalar>::getPointsAmount() const {
+    return pointsAmount;
+}
+
+template<typename Scalar>
+bool StreamingHull<Scalar>::fold() {
+    /* Culling drops the points of the chunk that are inside the polytope of the extreme points, which
+     * is inside the running hull, before any of them is copied */
+    if(!hull.tryBuild(points, threadsAmount)) {
+        verticesAmount = points.size();
+        return false;
+    }
+
+    /* The vertices are sorted so each one is moved to a position that is not after its own */
+    std::vector<uint> vertices = hull.getVertices();
+    std::sort(vertices.begin(), vertices.end());
+
+    for(uint i = 0 ; i < vertices.size() ; ++i) {
+        points[i] = points[vertices[i]];
+    }
+    verticesAmount = vertices.size();
+
+    return true;
+}
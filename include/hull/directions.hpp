@@ -0,0 +1,27 @@
+/***************************************************************************************************
+ * @file  directions.hpp
+ * @brief Declaration of functions to create sets of directions
+ **************************************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <sys/types.h>
+#include "maths/vec3.hpp"
+
+namespace Directions {
+    /**
+     * @brief Creates directions from the center of a 3x3x3 grid towards its other cells: the 6 axes
+     * first, then the 8 diagonals going through the corners and finally the 12 diagonals going through
+     * the middle of the edges. The directions are not normalized.
+     * @param amount The amount of directions, at most 26.
+     */
+    std::vector<vec3> lattice(uint amount);
+
+    /**
+     * @brief Creates directions spread evenly over the half sphere of positive z along a Fibonacci spiral.
+     * Together with their opposites, they cover the whole sphere. The directions are normalized.
+     * @param amount The amount of directions.
+     */
+    std::vector<vec3> hemisphere(uint amount);
+}
@@ -0,0 +1,50 @@
+/***************************************************************************************************
+ * @file  exporters.hpp
+ * @brief Declaration of functions to save hulls as indexed meshes
+ **************************************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include "maths/vec3.hpp"
+
+/**
+ * The whole file is formatted in memory first and written with a single call, see
+ * ConvexHull::getIndexedMesh for the vertices and triangles of a hull.
+ */
+namespace Exporters {
+    /**
+     * @enum Format
+     * @brief The formats a mesh can be saved in.
+     */
+    enum class Format {
+        Ply, ///< Binary little-endian PLY, with a vertex and a face element.
+        Obj, ///< Wavefront OBJ, with v and f lines.
+        Stl  ///< Binary STL. It has no index, each triangle stores its normal and its vertices.
+    };
+
+    /**
+     * @brief Finds the format of a file from its extension : .ply, .obj or .stl.
+     * @param path The path of the file.
+     * @return The format.
+     */
+    Format getFormat(const std::string& path);
+
+    /**
+     * @brief Saves a triangle mesh.
+     * @param path The path of the file, whose extension gives its format.
+     * @param vertices The vertices.
+     * @param triangles The indices in vertices of the vertices of each triangle, 3 per triangle.
+     */
+    void save(const std::string& path, const std::vector<vec3>& vertices, const std::vector<uint>& triangles);
+
+    /**
+     * @brief Saves a triangle mesh. PLY files store double coordinates, STL files always store floats.
+     * @param path The path of the file, whose extension gives its format.
+     * @param vertices The vertices.
+     * @param triangles The indices in vertices of the vertices of each triangle, 3 per triangle.
+     */
+    void save(const std::string& path, const std::vector<dvec3>& vertices, const std::vector<uint>& triangles);
+}
@@ -0,0 +1,50 @@
+/***************************************************************************************************
+ * @file  generators.hpp
+ * @brief Declaration of functions to generate point clouds
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <sys/types.h>
+#include "maths/vec3.hpp"
+
+/**
+ * The points are drawn from a counter-based random generator (Philox4x32-10) : point i only depends
+ * on the seed and on i, so a cloud is the same whatever the amount of threads that generated it. The
+ * transforms only use basic operations, so it is also the same whatever the instruction set used.
+ */
+namespace Generators {
+    /**
+     * @enum Distribution
+     * @brief The distributions points can be drawn from.
+     */
+    enum class Distribution {
+        Cube,     ///< Uniform in the cube [-1, 1]³.
+        Ball,     ///< Uniform in the ball of radius 1.
+        Sphere,   ///< Uniform on the sphere of radius 1.
+        Gaussian, ///< Standard normal on each axis.
+        Clustered ///< Normal with a deviation of 0.05 around 16 centers that are uniform in [-1, 1]³.
+    };
+
+    /**
+     * @brief Fills a point buffer with random points.
+     * @param points The buffer.
+     * @param count The amount of points.
+     * @param distribution The distribution of the points.
+     * @param seed The seed, the same seed always gives the same points.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void generate(vec3* points, uint64_t count, Distribution distribution, uint64_t seed, uint threadsAmount = 0);
+
+    /**
+     * @brief Fills a point buffer with random points. They are drawn in single precision, so they are
+     * the points of the float version converted to double.
+     * @param points The buffer.
+     * @param count The amount of points.
+     * @param distribution The distribution of the points.
+     * @param seed The seed, the same seed always gives the same points.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void generate(dvec3* points, uint64_t count, Distribution distribution, uint64_t seed, uint threadsAmount = 0);
+}
@@ -0,0 +1,86 @@
+/***************************************************************************************************
+ * @file  kernels.hpp
+ * @brief Declaration of the SIMD kernels testing points against planes and directions
+ **************************************************************************************************/
+
+#pragma once
+
+#include <sys/types.h>
+#include "hull/PointCloud.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @struct Plane
+ * @brief Represents the plane of the points P such that dot(normal, P) = offset. The normal does not
+ * need to be normalized, distances to the plane are then scaled by its length.
+ * @tparam Scalar The type of the coordinates.
+ */
+template<typename Scalar>
+struct Plane {
+    tvec3<Scalar> normal; ///< The normal of the plane.
+    Scalar offset;        ///< The dot product of the normal with any point of the plane.
+};
+
+/**
+ * The kernels are compiled for AVX2, SSE2 and without SIMD, for float and double coordinates. The best
+ * version the processor supports is picked the first time a kernel is called.
+ */
+namespace Kernels {
+    /**
+     * @brief Calculates the signed distances of points of a cloud to a plane and searches the farthest
+     * one in the same pass.
+     * @param cloud The cloud.
+     * @param indices The positions of the points in the cloud.
+     * @param count The amount of points.
+     * @param plane The plane.
+     * @param distances The distances, dot(normal, P) - offset for each point P.
+     * @return The position in indices of the largest distance, the first one on ties. 0 when there is no point.
+     */
+    uint distances(const PointCloud<float>& cloud, const uint* indices, uint count, const Plane<float>& plane, float* distances);
+
+    /**
+     * @brief Calculates the signed distances of points of a cloud to a plane and searches the farthest
+     * one in the same pass.
+     * @param cloud The cloud.
+     * @param indices The positions of the points in the cloud.
+     * @param count The amount of points.
+     * @param plane The plane.
+     * @param distances The distances, dot(normal, P) - offset for each point P.
+     * @return The position in indices of the largest distance, the first one on ties. 0 when there is no point.
+     */
+    uint distances(const PointCloud<double>& cloud, const uint* indices, uint count, const Plane<double>& plane, double* distances);
+
+    /**
+     * @brief Projects points on directions and calculates the largest and smallest projection along each one.
+     * @param x The x coordinates of the points.
+     * @param y The y coordinates of the points.
+     * @param z The z coordinates of the points.
+     * @param count The amount of points, at least 1.
+     * @param directions The directions.
+     * @param directionsAmount The amount of directions.
+     * @param maximums The largest dot product of a point with each direction.
+     * @param minimums The smallest dot product of a point with each direction.
+     */
+    void projectionBounds(const float* x, const float* y, const float* z, uint count, const tvec3<float>* directions,
+                          uint directionsAmount, float* maximums, float* minimums);
+
+    /**
+     * @brief Projects points on directions and calculates the largest and smallest projection along each one.
+     * @param x The x coordinates of the points.
+     * @param y The y coordinates of the points.
+     * @param z The z coordinates of the points.
+     * @param count The amount of points, at least 1.
+     * @param directions The directions.
+     * @param directionsAmount The amount of directions.
+     * @param maximums The largest dot product of a point with each direction.
+     * @param minimums The smallest dot product of a point with each direction.
+     */
+    void projectionBounds(const double* x, const double* y, const double* z, uint count, const tvec3<double>* directions,
+                          uint directionsAmount, double* maximums, double* minimums);
+
+    /**
+     * @brief Getter for the instruction set of the kernels that are used.
+     * @return "AVX2", "SSE2" or "Scalar".
+     */
+    const char* getInstructionSet();
+}
@@ -0,0 +1,94 @@
+/***************************************************************************************************
+ * @file  parsers.hpp
+ * @brief Declaration of functions to read point clouds from text files
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <sys/types.h>
+#include "maths/vec3.hpp"
+
+/**
+ * The text is cut in chunks that begin at the start of a line and parsed in two parallel passes : the
+ * first one counts the points of each chunk so the second one can write them straight at their place
+ * in the output. Numbers are read with std::from_chars.
+ */
+namespace Parsers {
+    /**
+     * @enum Format
+     * @brief The text formats points can be read from.
+     */
+    enum class Format {
+        Xyz, ///< One point per line, its coordinates being the first 3 columns separated by spaces, tabs, commas or semicolons. Lines that do not start with a number are skipped, and so is a first line that only holds an integer like the amount of points of PTS files.
+        Obj, ///< Wavefront OBJ, only the v lines are read.
+        Ply  ///< ASCII PLY, only the x, y and z properties of the vertex element are read.
+    };
+
+    /**
+     * @struct UninitializedAllocator
+     * @brief Allocator that leaves the elements a vector is resized with uninitialized, so the threads that
+     * parse the points are the first to write the memory of their own range.
+     * @tparam T The type of the elements.
+     */
+    template<typename T>
+    struct UninitializedAllocator : std::allocator<T> {
+        UninitializedAllocator() = default;
+
+        template<typename U>
+        UninitializedAllocator(const UninitializedAllocator<U>&) { }
+
+        template<typename U, typename... Arguments>
+        void construct(U* pointer, Arguments&&... arguments) {
+            if constexpr(sizeof...(Arguments) > 0) { ::new(static_cast<void*>(pointer)) U(std::forward<Arguments>(arguments)...); }
+        }
+    };
+
+    template<typename Scalar>
+    using Points = std::vector<tvec3<Scalar>, UninitializedAllocator<tvec3<Scalar>>>; ///< The points read from a text.
+
+    /**
+     * @brief Finds the format of a file from its extension : .obj, .ply, and .xyz, .csv, .txt or .pts.
+     * @param path The path of the file.
+     * @return The format.
+     */
+    Format getFormat(const std::string& path);
+
+    /**
+     * @brief Reads points from text.
+     * @param text The text.
+     * @param format The format of the text.
+     * @param points The points, replaced by the ones of the text.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void parse(std::string_view text, Format format, Points<float>& points, uint threadsAmount = 0);
+
+    /**
+     * @brief Reads points from text.
+     * @param text The text.
+     * @param format The format of the text.
+     * @param points The points, replaced by the ones of the text.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void parse(std::string_view text, Format format, Points<double>& points, uint threadsAmount = 0);
+
+    /**
+     * @brief Reads points from a text file, which is mapped in memory rather than copied.
+     * @param path The path of the file, whose extension gives its format.
+     * @param points The points, replaced by the ones of the file.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void load(const std::string& path, Points<float>& points, uint threadsAmount = 0);
+
+    /**
+     * @brief Reads points from a text file, which is mapped in memory rather than copied.
+     * @param path The path of the file, whose extension gives its format.
+     * @param points The points, replaced by the ones of the file.
+     * @param threadsAmount The amount of threads to use, 0 for as many as the hardware supports.
+     */
+    void load(const std::string& path, Points<double>& points, uint threadsAmount = 0);
+}
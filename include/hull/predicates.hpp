@@ -0,0 +1,59 @@
+/***************************************************************************************************
+ * @file  predicates.hpp
+ * @brief Declaration of the robust geometric predicates
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec3.hpp"
+
+/**
+ * The predicates are evaluated in double precision first. The exact result is only calculated, with
+ * floating point expansions, when the error bound of the double evaluation does not give its sign.
+ * They are compiled without -ffast-math since the error bounds rely on IEEE rounding.
+ */
+namespace Predicates {
+    /**
+     * @brief Calculates the orientation of a point relative to the plane of a triangle.
+     * @param a The first vertex of the triangle.
+     * @param b The second vertex of the triangle.
+     * @param c The third vertex of the triangle.
+     * @param d The point.
+     * @return A value with the exact sign of dot(cross(b - a, c - a), d - a) : positive when the point is
+     * above the triangle, negative when it is below and zero when it is on its plane.
+     */
+    double orientation(const vec3& a, const vec3& b, const vec3& c, const vec3& d);
+
+    /**
+     * @brief Calculates the orientation of a point relative to the plane of a triangle.
+     * @param a The first vertex of the triangle.
+     * @param b The second vertex of the triangle.
+     * @param c The third vertex of the triangle.
+     * @param d The point.
+     * @return A value with the exact sign of dot(cross(b - a, c - a), d - a).
+     */
+    double orientation(const dvec3& a, const dvec3& b, const dvec3& c, const dvec3& d);
+
+    /**
+     * @brief Calculates a bound of the error of dot(normal, P) - offset evaluated in single precision
+     * with the plane of a triangle, normal = cross(b - a, c - a) and offset = dot(normal, a). When the
+     * distance is larger than the bound, its sign is the one of orientation(a, b, c, P).
+     * @param a The first vertex of the triangle.
+     * @param b The second vertex of the triangle.
+     * @param c The third vertex of the triangle.
+     * @param magnitude The largest absolute value of the coordinates of the points P.
+     * @return The bound.
+     */
+    float getPlaneErrorBound(const vec3& a, const vec3& b, const vec3& c, float magnitude);
+
+    /**
+     * @brief Calculates a bound of the error of dot(normal, P) - offset evaluated in double precision
+     * with the plane of a triangle.
+     * @param a The first vertex of the triangle.
+     * @param b The second vertex of the triangle.
+     * @param c The third vertex of the triangle.
+     * @param magnitude The largest absolute value of the coordinates of the points P.
+     * @return The bound.
+     */
+    double getPlaneErrorBound(const dvec3& a, const dvec3& b, const dvec3& c, double magnitude);
+}
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cmath>
 #include "vec2.hpp"
 #include "vec3.hpp"
 #include "vec4.hpp"
@@ -21,7 +22,8 @@ float length(const vec2& vec);
  * @param vec The vec3.
  * @return The length.
  */
-float length(const vec3& vec);
+template<typename Scalar>
+Scalar length(const tvec3<Scalar>& vec);
 
 /**
  * @brief Calculates the length of a vec4.
@@ -44,7 +46,8 @@ float dot(const vec2& left, const vec2& right);
  * @param right The right operand.
  * @return The dot product of the two vec3.
  */
-float dot(const vec3& left, const vec3& right);
+template<typename Scalar>
+Scalar dot(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /**
  * @brief Calculates the dot product of two vec4.
@@ -66,7 +69,8 @@ vec2 normalize(const vec2& vec);
  * @param vec The vec3.
  * @return The normalized vec3.
  */
-vec3 normalize(const vec3& vec);
+template<typename Scalar>
+tvec3<Scalar> normalize(const tvec3<Scalar>& vec);
 
 /**
  * @brief Calculates the normalized vector of a vec4.
@@ -81,4 +85,7 @@ vec4 normalize(const vec4& vec);
  * @param right The right operand.
  * @return The cross product of the two Vector.
  */
-Vector cross(const Vector& left, const Vector& right);
\ No newline at end of file
+template<typename Scalar>
+tvec3<Scalar> cross(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
+
+#include "geometry.tpp"
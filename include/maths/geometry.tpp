@@ -0,0 +1,28 @@
+/***************************************************************************************************
+ * @file  geometry.tpp
+ * @brief Implementation of the template functions regarding vector maths
+ **************************************************************************************************/
+
+template<typename Scalar>
+Scalar length(const tvec3<Scalar>& vec) {
+    return std::sqrt(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z);
+}
+
+template<typename Scalar>
+Scalar dot(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return left.x * right.x + left.y * right.y + left.z * right.z;
+}
+
+template<typename Scalar>
+tvec3<Scalar> normalize(const tvec3<Scalar>& vec) {
+    return vec / length(vec);
+}
+
+template<typename Scalar>
+tvec3<Scalar> cross(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return tvec3<Scalar>(
+        left.y * right.z - left.z * right.y,
+        left.z * right.x - left.x * right.z,
+        left.x * right.y - left.y * right.x
+    );
+}
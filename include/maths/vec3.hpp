@@ -1,21 +1,25 @@
 /***************************************************************************************************
  * @file  vec3.hpp
- * @brief Declaration of the vec3 struct
+ * @brief Declaration of the tvec3 struct
  **************************************************************************************************/
 
 #pragma once
 
 #include <iostream>
+#include <random>
+#include <type_traits>
 
 /**
- * @struct vec3
+ * @struct tvec3
  * @brief Represents a 3 dimensional vector.
+ * @tparam Scalar The type of the components.
  */
-struct vec3 {
+template<typename Scalar>
+struct tvec3 {
     /**
      * @brief Constructs a vec3 with all components equal to 0.
      */
-    vec3();
+    tvec3();
 
     /**
      * @brief Constructs a vec3 with a specific value for each component.
@@ -23,69 +27,69 @@ struct vec3 {
      * @param y The value of the y component.
      * @param z The value of the z component.
      */
-    vec3(float x, float y, float z);
+    tvec3(Scalar x, Scalar y, Scalar z);
 
     /**
      * @brief Constructs a vec3 with the same value for each component.
      * @param scalar The value of each component.
      */
-    explicit vec3(float scalar);
+    explicit tvec3(Scalar scalar);
 
     /**
      * @brief Adds another vec3's components to the current instance's components.
      * @param vec The vec3 to add.
      * @return A reference to this instance.
      */
-    vec3& operator +=(const vec3& vec);
+    tvec3& operator +=(const tvec3& vec);
 
     /**
      * @brief Subtracts the current instance's components by another vec3's components.
      * @param vec The vec3 to subtract by.
      * @return A reference to this instance.
      */
-    vec3& operator -=(const vec3& vec);
+    tvec3& operator -=(const tvec3& vec);
 
     /**
      * @brief Multiplies the current instance's components by another vec3's components.
      * @param vec The vec3 to multiply by.
      * @return A reference to this instance.
      */
-    vec3& operator *=(const vec3& vec);
+    tvec3& operator *=(const tvec3& vec);
 
     /**
      * @brief Divides the current instance's components by another vec3's components.
      * @param vec The vec3 to divide by.
      * @return A reference to this instance.
      */
-    vec3& operator /=(const vec3& vec);
+    tvec3& operator /=(const tvec3& vec);
 
     /**
      * @brief Adds a scalar to all of the current instance's components.
      * @param scalar The scalar to add.
      * @return A reference to this instance.
      */
-    vec3& operator +=(float scalar);
+    tvec3& operator +=(Scalar scalar);
 
     /**
      * @brief Subtracts all of the current instance's components by a scalar.
      * @param scalar The scalar to subtract by.
      * @return A reference to this instance.
      */
-    vec3& operator -=(float scalar);
+    tvec3& operator -=(Scalar scalar);
 
     /**
      * @brief Multiplies all of the current instance's components by a scalar.
      * @param scalar The scalar to multiply by.
      * @return A reference to this instance.
      */
-    vec3& operator *=(float scalar);
+    tvec3& operator *=(Scalar scalar);
 
     /**
      * @brief Divides all of the current instance's components by a scalar.
      * @param scalar The scalar to divide by.
      * @return A reference to this instance.
      */
-    vec3& operator /=(float scalar);
+    tvec3& operator /=(Scalar scalar);
 
     /**
      * @brief Creates a random vec3 with all components in the same bounds.
@@ -93,7 +97,7 @@ struct vec3 {
      * @param max The minimum value a component can have.
      * @return A random vec3.
      */
-    static vec3 random(float min, float max);
+    static tvec3 random(Scalar min, Scalar max);
 
     /**
      * @brief Creates a random vec3 with specific bounds for each component.
@@ -101,13 +105,16 @@ struct vec3 {
      * @param max The minimum value for each component.
      * @return A random vec3.
      */
-    static vec3 random(const vec3& min, const vec3& max);
+    static tvec3 random(const tvec3& min, const tvec3& max);
 
-    float x; ///< The x component of the vec3.
-    float y; ///< The y component of the vec3.
-    float z; ///< The z component of the vec3.
+    Scalar x; ///< The x component of the vec3.
+    Scalar y; ///< The y component of the vec3.
+    Scalar z; ///< The z component of the vec3.
 };
 
+using vec3 = tvec3<float>;
+using dvec3 = tvec3<double>;
+
 using Color = vec3;
 using Point = vec3;
 using Vector = vec3;
@@ -119,7 +126,8 @@ using Vector = vec3;
  * @param vec The vec3 to write to the stream.
  * @return A reference to the output stream after writing the vec3.
  */
-std::ostream& operator <<(std::ostream& stream, const vec3& vec);
+template<typename Scalar>
+std::ostream& operator <<(std::ostream& stream, const tvec3<Scalar>& vec);
 
 /**
  * @brief Reads three values from the input stream and assigns them to the x, y and z components
@@ -128,70 +136,80 @@ std::ostream& operator <<(std::ostream& stream, const vec3& vec);
  * @param vec The vec3 to assign the read values to.
  * @return A reference to the input stream after reading the values and assigning them to vec3.
  */
-std::istream& operator >>(std::istream& stream, vec3& vec);
+template<typename Scalar>
+std::istream& operator >>(std::istream& stream, tvec3<Scalar>& vec);
 
 /** @brief Adds a vec3's components to another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise sum of the two vec3.
  */
-vec3 operator +(const vec3& left, const vec3& right);
+template<typename Scalar>
+tvec3<Scalar> operator +(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /** @brief Subtracts a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise subtraction of the first vec3 by the second.
  */
-vec3 operator -(const vec3& left, const vec3& right);
+template<typename Scalar>
+tvec3<Scalar> operator -(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /** @brief Multiplies a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise product of the two vec3.
  */
-vec3 operator *(const vec3& left, const vec3& right);
+template<typename Scalar>
+tvec3<Scalar> operator *(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /** @brief Divides a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise division of the first vec3 by the second.
  */
-vec3 operator /(const vec3& left, const vec3& right);
+template<typename Scalar>
+tvec3<Scalar> operator /(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /** @brief Adds a scalar to each of a vec3's components.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise sum of a vec3 by a scalar.
  */
-vec3 operator +(const vec3& vec, float scalar);
+template<typename Scalar>
+tvec3<Scalar> operator +(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar);
 
 /** @brief Subtracts each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise subtraction of a vec3 by a scalar.
  */
-vec3 operator -(const vec3& vec, float scalar);
+template<typename Scalar>
+tvec3<Scalar> operator -(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar);
 
 /** @brief Multiplies each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise product of a vec3 by a scalar.
  */
-vec3 operator *(const vec3& vec, float scalar);
+template<typename Scalar>
+tvec3<Scalar> operator *(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar);
 
 /** @brief Multiplies each of a vec3's components by a scalar.
  *  @param scalar The scalar.
  *  @param vec The vec3.
  *  @return The component-wise product of a vec3 by a scalar.
  */
-vec3 operator *(float scalar, const vec3& vec);
+template<typename Scalar>
+tvec3<Scalar> operator *(std::type_identity_t<Scalar> scalar, const tvec3<Scalar>& vec);
 
 /** @brief Divides each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise division of a vec3 by a scalar.
  */
-vec3 operator /(const vec3& vec, float scalar);
+template<typename Scalar>
+tvec3<Scalar> operator /(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar);
 
 /**
  * @brief Tests whether two vec3 are equal.
@@ -199,7 +217,8 @@ vec3 operator /(const vec3& vec, float scalar);
  * @param right The right operand.
  * @return Whether the two vec3 are equal.
  */
-bool operator ==(const vec3& left, const vec3& right);
+template<typename Scalar>
+bool operator ==(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
 
 /**
  * @brief Tests whether two vec3 are different.
@@ -207,4 +226,7 @@ bool operator ==(const vec3& left, const vec3& right);
  * @param right The right operand.
  * @return Whether the two vec3 are different.
  */
-bool operator !=(const vec3& left, const vec3& right);
\ No newline at end of file
+template<typename Scalar>
+bool operator !=(const tvec3<Scalar>& left, const tvec3<Scalar>& right);
+
+#include "vec3.tpp"
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ * @file  vec3.tpp
+ * @brief Implementation of the tvec3 struct
+ **************************************************************************************************/
+
+template<typename Scalar>
+tvec3<Scalar>::tvec3() : x(0), y(0), z(0) { }
+
+template<typename Scalar>
+tvec3<Scalar>::tvec3(Scalar x, Scalar y, Scalar z) : x(x), y(y), z(z) { }
+
+template<typename Scalar>
+tvec3<Scalar>::tvec3(Scalar scalar) : x(scalar), y(scalar), z(scalar) { }
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator +=(const tvec3& vec) {
+    x += vec.x;
+    y += vec.y;
+    z += vec.z;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator -=(const tvec3& vec) {
+    x -= vec.x;
+    y -= vec.y;
+    z -= vec.z;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator *=(const tvec3& vec) {
+    x *= vec.x;
+    y *= vec.y;
+    z *= vec.z;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator /=(const tvec3& vec) {
+    x /= vec.x;
+    y /= vec.y;
+    z /= vec.z;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator +=(Scalar scalar) {
+    x += scalar;
+    y += scalar;
+    z += scalar;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator -=(Scalar scalar) {
+    x -= scalar;
+    y -= scalar;
+    z -= scalar;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator *=(Scalar scalar) {
+    x *= scalar;
+    y *= scalar;
+    z *= scalar;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar>& tvec3<Scalar>::operator /=(Scalar scalar) {
+    x /= scalar;
+    y /= scalar;
+    z /= scalar;
+
+    return *this;
+}
+
+template<typename Scalar>
+tvec3<Scalar> tvec3<Scalar>::random(Scalar min, Scalar max) {
+    static std::random_device seed;
+    static std::default_random_engine generator(seed());
+
+    return tvec3(std::uniform_real_distribution<Scalar>(min, max)(generator),
+                std::uniform_real_distribution<Scalar>(min, max)(generator),
+                std::uniform_real_distribution<Scalar>(min, max)(generator));
+}
+
+template<typename Scalar>
+tvec3<Scalar> tvec3<Scalar>::random(const tvec3& min, const tvec3& max) {
+    static std::random_device seed;
+    static std::default_random_engine generator(seed());
+
+    return tvec3(std::uniform_real_distribution<Scalar>(min.x, max.x)(generator),
+                std::uniform_real_distribution<Scalar>(min.y, max.y)(generator),
+                std::uniform_real_distribution<Scalar>(min.z, max.z)(generator));
+}
+
+template<typename Scalar>
+std::ostream& operator <<(std::ostream& stream, const tvec3<Scalar>& vec) {
+    stream << "( " << vec.x << " ; " << vec.y << " ; " << vec.z << " )";
+    return stream;
+}
+
+template<typename Scalar>
+std::istream& operator >>(std::istream& stream, tvec3<Scalar>& vec) {
+    stream >> vec.x >> vec.y >> vec.z;
+    return stream;
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator +(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return tvec3<Scalar>(
+        left.x + right.x,
+        left.y + right.y,
+        left.z + right.z
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator -(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return tvec3<Scalar>(
+        left.x - right.x,
+        left.y - right.y,
+        left.z - right.z
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator *(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return tvec3<Scalar>(
+        left.x * right.x,
+        left.y * right.y,
+        left.z * right.z
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator /(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return tvec3<Scalar>(
+        left.x / right.x,
+        left.y / right.y,
+        left.z / right.z
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator +(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar) {
+    return tvec3<Scalar>(
+        vec.x + scalar,
+        vec.y + scalar,
+        vec.z + scalar
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator -(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar) {
+    return tvec3<Scalar>(
+        vec.x - scalar,
+        vec.y - scalar,
+        vec.z - scalar
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator *(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar) {
+    return tvec3<Scalar>(
+        vec.x * scalar,
+        vec.y * scalar,
+        vec.z * scalar
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator *(std::type_identity_t<Scalar> scalar, const tvec3<Scalar>& vec) {
+    return tvec3<Scalar>(
+        scalar * vec.x,
+        scalar * vec.y,
+        scalar * vec.z
+    );
+}
+
+template<typename Scalar>
+tvec3<Scalar> operator /(const tvec3<Scalar>& vec, std::type_identity_t<Scalar> scalar) {
+    return tvec3<Scalar>(
+        vec.x / scalar,
+        vec.y / scalar,
+        vec.z / scalar
+    );
+}
+
+template<typename Scalar>
+bool operator ==(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return left.x == right.x && left.y == right.y && left.z == right.z;
+}
+
+template<typename Scalar>
+bool operator !=(const tvec3<Scalar>& left, const tvec3<Scalar>& right) {
+    return left.x != right.x || left.y != right.y || left.z != right.z;
+}
@@ -6,18 +6,27 @@
 #version 460 core
 
 in vec3 position;
+flat in vec3 normal;
 in vec3 color;
 
 out vec4 fragColor;
 
+uniform uint attributes;
 uniform bool useUniformColor;
 uniform vec3 uColor;
 uniform float alpha;
 
+const vec3 LIGHT_DIRECTION = normalize(vec3(0.3f, 1.0f, 0.5f));
+
 void main() {
     if(useUniformColor) {
         fragColor = vec4(uColor, alpha);
     } else {
         fragColor = vec4(color, alpha);
     }
+
+    /* Meshes with normals are lit by a directional light, with a flat normal for each face */
+    if((attributes & 2u) != 0u) {
+        fragColor.rgb *= 0.35f + 0.65f * max(dot(normal, LIGHT_DIRECTION), 0.0f);
+    }
 }
@@ -6,9 +6,11 @@
 #version 460 core
 
 layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
 layout (location = 3) in vec3 aColor;
 
 out vec3 position;
+flat out vec3 normal;
 out vec3 color;
 
 uniform mat4 mvp;
@@ -19,5 +21,6 @@ void main() {
 
     gl_Position = mvp * pos;
     position = (model * pos).xyz;
+    normal = aNormal;
     color = aColor;
 }
\ No newline at end of file
@@ -117,6 +117,9 @@ void Application::handleKeyEvent(int key) {
         case GLFW_KEY_R:
             hull.create(pointsAmount, -boundingCubeSize / 2.0f, boundingCubeSize / 2.0f);
             break;
+        case GLFW_KEY_F:
+            hull.setFlatShading(!hull.flatShading);
+            break;
         case GLFW_KEY_SPACE:
             camera.move(CameraControls::upward, delta);
             break;
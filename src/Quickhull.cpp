@@ -5,160 +5,109 @@
 
 #include "Quickhull.hpp"
 
-#include <unordered_set>
+#include <random>
+#include "hull/generators.hpp"
 #include "maths/geometry.hpp"
 
 Quickhull::Quickhull(uint pointsAmount, float boundsMin, float boundsMax)
-    : points(pointsAmount), pointsMesh(GL_POINTS), linesMesh(GL_LINES), mesh(GL_TRIANGLES) {
+    : points(pointsAmount), seed(std::random_device()()), flatShading(false),
+      pointsMesh(GL_POINTS), linesMesh(GL_LINES), mesh(GL_TRIANGLES) {
     create(pointsAmount, boundsMin, boundsMax);
 }
 
 void Quickhull::create(uint pointsAmount, float boundsMin, float boundsMax) {
     points.resize(pointsAmount);
     pointsMesh.clear();
-    linesMesh.clear();
-    mesh.clear();
 
-    uint left = 0;
-    uint right = 0;
-    uint bottom = 0;
-    uint top = 0;
+    /* Every call draws a new cloud, the points are generated in [-1, 1]³ and moved to the bounds */
+    Generators::generate(points.data(), pointsAmount, Generators::Distribution::Cube, seed++);
 
     for(uint i = 0 ; i < pointsAmount ; ++i) {
-        points[i] = vec3::random(boundsMin, boundsMax);
+        points[i] = (points[i] + 1.0f) * ((boundsMax - boundsMin) / 2.0f) + boundsMin;
+        pointsMesh.addPosition(points[i]);
+    }
 
-        if(points[i].x < points[left].x) { left = i; }
-        if(points[i].x > points[right].x) { right = i; }
-        if(points[i].y < points[bottom].y) { bottom = i; }
-        if(points[i].y > points[top].y) { top = i; }
+    /* A cloud without volume has no hull to draw, which is no reason to close the viewer */
+    hull.tryBuild(points);
+    updateHullMeshes();
+}
 
-        linesMesh.addPosition(points[i]);
-    }
+void Quickhull::setFlatShading(bool flatShading) {
+    this->flatShading = flatShading;
+    updateHullMeshes();
+}
 
-    // TODO : Check if two indices are the same
+void Quickhull::updateHullMeshes() {
+    std::vector<vec3> vertices;
+    std::vector<uint> triangles;
+    hull.getIndexedMesh(vertices, triangles);
 
-    std::vector<Triangle> faces;
-    std::vector<std::vector<uint>> pointsAboveFace;
-    auto addFaceAwayFromCenter = [this, &faces, &pointsAboveFace](const vec3& center, uint A, uint B, uint C) {
-        if(dot(center - points[A], cross(points[B] - points[A], points[C] - points[A])) >= 0.0f) {
-            faces.emplace_back(A, C, B);
-        } else {
-            faces.emplace_back(A, B, C);
-        }
-        pointsAboveFace.emplace_back();
-    };
-
-    vec3 center = (points[left] + points[right] + points[bottom] + points[top]) / 4.0f;
-    addFaceAwayFromCenter(center, top, left, bottom);
-    addFaceAwayFromCenter(center, top, right, bottom);
-    addFaceAwayFromCenter(center, top, left, right);
-    addFaceAwayFromCenter(center, left, right, bottom);
-
-    linesMesh.addLine(top, bottom);
-    linesMesh.addLine(top, left);
-    linesMesh.addLine(top, right);
-    linesMesh.addLine(left, right);
-    linesMesh.addLine(left, bottom);
-    linesMesh.addLine(right, bottom);
-
-    std::unordered_set<uint> assignedPoints;
-    assignedPoints.emplace(left);
-    assignedPoints.emplace(right);
-    assignedPoints.emplace(bottom);
-    assignedPoints.emplace(top);
-
-    for(uint i = 0 ; i < faces.size() ; ++i) {
-        const vec3& A = points[faces[i].A];
-        const vec3& B = points[faces[i].B];
-        const vec3& C = points[faces[i].C];
-        vec3 normal = cross(B - A, C - A);
-
-        for(uint j = 0 ; j < pointsAmount ; ++j) {
-            if(!assignedPoints.contains(j) && dot(points[j] - A, normal) >= 0.0f) {
-                pointsAboveFace[i].push_back(j);
-                assignedPoints.emplace(j);
-            }
-        }
-    }
+    linesMesh.clear();
+    mesh.clear();
 
-    // vec3 colors[4]{
-        // vec3(1.0f, 0.0f, 0.0f),
-        // vec3(1.0f, 1.0f, 0.0f),
-        // vec3(0.0f, 1.0f, 0.0f),
-        // vec3(0.0f, 1.0f, 1.0f)
-    // };
-
-    // for(uint i = 0 ; i < faces.size() ; ++i) {
-    //     mesh.addPosition(points[faces[i].A]);
-    //     mesh.addColor(colors[i]);
-    //     mesh.addPosition(points[faces[i].B]);
-    //     mesh.addColor(colors[i]);
-    //     mesh.addPosition(points[faces[i].C]);
-    //     mesh.addColor(colors[i]);
-    //
-    //     for(uint index : pointsAboveFace[i]) {
-    //         pointsMesh.addPosition(points[index]);
-    //         pointsMesh.addColor(colors[i]);
-    //     }
-    // }
-
-    for(uint i = 0 ; i < points.size() ; ++i) {
-        pointsMesh.addPosition(points[i]);
+    for(const vec3& vertex : vertices) {
+        linesMesh.addPosition(vertex);
     }
 
-    for(uint i = 0 ; i < faces.size() ; ++i) {
-        if(pointsAboveFace[i].empty()) { continue; }
-
-        const vec3& A = points[faces[i].A];
-        const vec3& B = points[faces[i].B];
-        const vec3& C = points[faces[i].C];
+    /* Every edge is shared by two faces so it is only added from the one where it goes upwards */
+    for(uint i = 0 ; i < triangles.size() ; i += 3) {
+        for(uint k = 0 ; k < 3 ; ++k) {
+            uint origin = triangles[i + k];
+            uint destination = triangles[i + (k + 1) % 3];
 
-        vec3 normal = normalize(cross(B - A, C - A));
-        auto projectOnPlane = [&A, &normal](const vec3& P) -> vec3 {
-            return P - dot(P - A, normal) * normal;
-        };
+            if(origin < destination) {
+                linesMesh.addLine(origin, destination);
+            }
+        }
+    }
 
-        uint farthest = pointsAboveFace[i][0];
-        float farthestDistance = length(projectOnPlane(points[pointsAboveFace[i][0]]) - points[pointsAboveFace[i][0]]);
+    if(!flatShading) {
+        for(const vec3& vertex : vertices) {
+            mesh.addPosition(vertex);
+        }
 
-        for(uint j = 1 ; j < pointsAboveFace[i].size() ; ++j) {
-            uint index = pointsAboveFace[i][j];
-            float distance = length(projectOnPlane(points[index]) - points[index]);
-            if(distance > farthestDistance) {
-                farthest = index;
-                farthestDistance = distance;
-            }
+        for(uint i = 0 ; i < triangles.size() ; i += 3) {
+            mesh.addTriangle(triangles[i], triangles[i + 1], triangles[i + 2]);
         }
+        return;
+    }
 
-        center = (A + B + C + points[farthest]) / 4.0f;
-        addFaceAwayFromCenter(center, farthest, faces[i].A, faces[i].B);
-        addFaceAwayFromCenter(center, farthest, faces[i].A, faces[i].C);
-        addFaceAwayFromCenter(center, farthest, faces[i].B, faces[i].C);
+    /* The normal is not interpolated, so a triangle takes the normal of its last vertex. Each face is
+     * rotated to end with a vertex that is not the last one of another face yet, and a vertex is only
+     * copied when its three vertices already are. A hull has about twice as many faces as vertices, so
+     * about one face in two needs a copy */
+    std::vector<vec3> normals(vertices.size(), vec3(0.0f));
+    std::vector<bool> used(vertices.size(), false);
 
-        std::unordered_set<uint> assigned;
-        assigned.emplace(farthest);
+    for(uint i = 0 ; i < triangles.size() ; i += 3) {
+        const uint* triangle = &triangles[i];
+        vec3 normal = normalize(cross(vertices[triangle[1]] - vertices[triangle[0]], vertices[triangle[2]] - vertices[triangle[0]]));
 
-        for(uint j = faces.size() - 3 ; j < faces.size() ; ++j) {
-            vec3 a = points[faces[j].A];
-            vec3 n = cross(points[faces[j].B] - a, points[faces[j].C] - a);
+        uint k = 0;
+        while(k < 3 && used[triangle[k]]) { ++k; }
 
-            for(uint index : pointsAboveFace[i]) {
-                if(!assigned.contains(index) && dot(points[index] - a, n) >= 0.0f) {
-                    pointsAboveFace[i].push_back(index);
-                    assigned.emplace(index);
-                }
-            }
+        uint first = triangle[0];
+        uint second = triangle[1];
+        uint last = vertices.size();
+
+        if(k < 3) {
+            first = triangle[(k + 1) % 3];
+            second = triangle[(k + 2) % 3];
+            last = triangle[k];
+        } else {
+            vertices.push_back(vertices[triangle[2]]);
+            normals.emplace_back(0.0f);
+            used.push_back(false);
         }
 
-        linesMesh.addLine(farthest, faces[i].A);
-        linesMesh.addLine(farthest, faces[i].B);
-        linesMesh.addLine(farthest, faces[i].C);
+        used[last] = true;
+        normals[last] = normal;
+        mesh.addTriangle(first, second, last);
     }
 
-    for(uint i = 0 ; i < faces.size() ; ++i) {
-        mesh.addPosition(points[faces[i].A]);
-        mesh.addPosition(points[faces[i].B]);
-        mesh.addPosition(points[faces[i].C]);
+    for(uint i = 0 ; i < vertices.size() ; ++i) {
+        mesh.addPosition(vertices[i]);
+        mesh.addNormal(normals[i]);
     }
 }
 
@@ -169,9 +118,10 @@ void Quickhull::draw(Shader* shader) {
     glLineWidth(3.0f);
     linesMesh.draw();
     glLineWidth(1.0f);
-    shader->setUniform("useUniformColor", false);
+    shader->setUniform("useUniformColor", flatShading);
 
     shader->setUniform("alpha", 0.5f);
     mesh.draw();
     shader->setUniform("alpha", 1.0f);
+    shader->setUniform("useUniformColor", false);
 }
@@ -0,0 +1,276 @@
+/***************************************************************************************************
+ * @file  hull_bench.cpp
+ * @brief Contains the benchmark of the hull construction
+ **************************************************************************************************/
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "hull/ConvexHull.hpp"
+#include "hull/generators.hpp"
+#include "hull/kernels.hpp"
+
+/**
+ * @brief Settings of the benchmark, read from the command line.
+ */
+struct Settings {
+    uint64_t minPointsAmount = 1000;        ///< The amount of points of the smallest input.
+    uint64_t maxPointsAmount = 100000000;   ///< The amount of points of the largest input.
+    uint threadsAmount = 1;                 ///< The amount of threads given to the hull, 0 for all of them.
+    double timeLimit = 60.0;                ///< The longest build time expected for the larger inputs.
+    double minMeasureTime = 0.5;            ///< The time over which the builds of small inputs are repeated.
+    uint seed = 1;                          ///< The seed of the inputs.
+    bool doublePrecision = false;           ///< Whether the hull is built from double coordinates.
+    std::string jsonPath;                   ///< The path of the JSON report, stdout if it is "-" and the table then goes to stderr.
+};
+
+/**
+ * @brief Measures of one input, written by the process that built its hull.
+ */
+struct Result {
+    double seconds;          ///< The best build time.
+    uint repetitions;        ///< The amount of builds.
+    uint64_t hullVertices;   ///< The amount of vertices of the hull.
+    uint64_t hullTriangles;  ///< The amount of triangles of the hull.
+    uint64_t inputBytes;     ///< The resident memory after the input was generated.
+    uint64_t peakBytes;      ///< The peak resident memory of the process.
+};
+
+/**
+ * @brief A distribution of the input points.
+ */
+struct Distribution {
+    const char* name;                           ///< The name of the distribution.
+    Generators::Distribution generated;         ///< The distribution the points are drawn from.
+    float heightScale;                          ///< The factor of the z coordinates, flattens the points when small.
+};
+
+/**
+ * @brief Getter for the peak resident memory of the process.
+ * @return The amount of bytes.
+ */
+static uint64_t getPeakBytes() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+}
+
+/**
+ * @brief Getter for the distributions of the benchmark.
+ * @return The distributions.
+ */
+static std::vector<Distribution> getDistributions() {
+    return {
+        { "cube", Generators::Distribution::Cube, 1.0f },
+        { "ball", Generators::Distribution::Ball, 1.0f },
+        { "sphere", Generators::Distribution::Sphere, 1.0f },
+        { "gaussian", Generators::Distribution::Gaussian, 1.0f },
+        { "clustered", Generators::Distribution::Clustered, 1.0f },
+        { "coplanar", Generators::Distribution::Cube, 1e-4f }
+    };
+}
+
+/**
+ * @brief Builds the hull of an input, repeating the build until the minimum measure time is reached.
+ * @tparam Scalar The type of the coordinates of the hull.
+ * @param distribution The distribution of the input.
+ * @param pointsAmount The amount of points of the input.
+ * @param settings The settings of the benchmark.
+ * @return The measures.
+ */
+template<typename Scalar>
+static Result measure(const Distribution& distribution, uint64_t pointsAmount, const Settings& settings) {
+    std::vector<typename ConvexHull<Scalar>::Vector3> points(pointsAmount);
+    Generators::generate(points.data(), pointsAmount, distribution.generated, settings.seed ^ pointsAmount);
+
+    if(distribution.heightScale != 1.0f) {
+        for(typename ConvexHull<Scalar>::Vector3& point : points) { point.z *= distribution.heightScale; }
+    }
+
+    Result result{};
+    result.seconds = std::numeric_limits<double>::max();
+    result.inputBytes = getPeakBytes();
+
+    ConvexHull<Scalar> hull;
+    double total = 0.0;
+
+    do {
+        auto start = std::chrono::steady_clock::now();
+        hull.build(points, settings.threadsAmount);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        result.seconds = std::min(result.seconds, seconds);
+        result.repetitions++;
+        total += seconds;
+    } while(total < settings.minMeasureTime);
+
+    result.hullVertices = hull.getVertices().size();
+    result.hullTriangles = hull.getTriangles().size() / 3;
+    result.peakBytes = getPeakBytes();
+
+    return result;
+}
+
+/**
+ * @brief Measures an input in a child process so the peak memory only accounts for that input.
+ * @param distribution The distribution of the input.
+ * @param pointsAmount The amount of points of the input.
+ * @param settings The settings of the benchmark.
+ * @param result The measures, only set when the child process succeeded.
+ * @return Whether the child process succeeded.
+ */
+static bool measureInChild(const Distribution& distribution, uint64_t pointsAmount, const Settings& settings, Result& result) {
+    int pipeEnds[2];
+    if(pipe(pipeEnds) != 0) {
+        throw std::runtime_error("Failed to create a pipe.");
+    }
+
+    pid_t child = fork();
+    if(child < 0) {
+        throw std::runtime_error("Failed to fork the benchmark.");
+    }
+
+    if(child == 0) {
+        close(pipeEnds[0]);
+        int status = 0;
+
+        try {
+            Result childResult = settings.doublePrecision ? measure<double>(distribution, pointsAmount, settings)
+                                                          : measure<float>(distribution, pointsAmount, settings);
+            if(write(pipeEnds[1], &childResult, sizeof(Result)) != sizeof(Result)) { status = 1; }
+        } catch(const std::exception& exception) {
+            std::cerr << "ERROR : " << exception.what() << '\n';
+            status = 1;
+        }
+
+        close(pipeEnds[1]);
+        _exit(status);
+    }
+
+    close(pipeEnds[1]);
+    bool succeeded = read(pipeEnds[0], &result, sizeof(Result)) == sizeof(Result);
+    close(pipeEnds[0]);
+
+    int status;
+    waitpid(child, &status, 0);
+
+    return succeeded && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * @brief Reads the settings from the command line.
+ * @param argc The amount of arguments.
+ * @param argv The arguments.
+ * @return The settings.
+ */
+static Settings parseSettings(int argc, char** argv) {
+    Settings settings;
+
+    for(int i = 1 ; i < argc ; ++i) {
+        std::string option = argv[i];
+        if(option == "--help") {
+            std::cout << "Usage : " << argv[0] << " [--min N] [--max N] [--threads N] [--time-limit SECONDS]"
+                      << " [--measure-time SECONDS] [--seed N] [--json PATH] [--double]\n";
+            std::exit(0);
+        }
+
+        if(option == "--double") {
+            settings.doublePrecision = true;
+            continue;
+        }
+
+        if(i + 1 == argc) {
+            throw std::runtime_error("Missing value after " + option + ".");
+        }
+
+        const char* value = argv[++i];
+        if(option == "--min") { settings.minPointsAmount = std::stod(value); }
+        else if(option == "--max") { settings.maxPointsAmount = std::stod(value); }
+        else if(option == "--threads") { settings.threadsAmount = std::stoul(value); }
+        else if(option == "--time-limit") { settings.timeLimit = std::stod(value); }
+        else if(option == "--measure-time") { settings.minMeasureTime = std::stod(value); }
+        else if(option == "--seed") { settings.seed = std::stoul(value); }
+        else if(option == "--json") { settings.jsonPath = value; }
+        else { throw std::runtime_error("Unknown option " + option + "."); }
+    }
+
+    if(settings.minPointsAmount < 4 || settings.maxPointsAmount > UINT_MAX) {
+        throw std::runtime_error("The amount of points must be between 4 and " + std::to_string(UINT_MAX) + ".");
+    }
+
+    return settings;
+}
+
+int main(int argc, char** argv) {
+    try {
+        Settings settings = parseSettings(argc, argv);
+        std::vector<Distribution> distributions = getDistributions();
+        std::string json = "{\n  \"instruction_set\": \"" + std::string(Kernels::getInstructionSet())
+                         + "\",\n  \"precision\": \"" + (settings.doublePrecision ? "double" : "float")
+                         + "\",\n  \"threads\": " + std::to_string(settings.threadsAmount) + ",\n  \"results\": [";
+        bool firstEntry = true;
+
+        /* The table goes to stderr when stdout holds the JSON report, so the report stays valid JSON */
+        FILE* table = settings.jsonPath == "-" ? stderr : stdout;
+
+        std::fprintf(table, "%-10s %12s %12s %14s %10s %12s %12s\n",
+                     "input", "points", "seconds", "points/s", "vertices", "input MiB", "peak MiB");
+
+        for(const Distribution& distribution : distributions) {
+            for(uint64_t pointsAmount = settings.minPointsAmount ; pointsAmount <= settings.maxPointsAmount ; pointsAmount *= 10) {
+                Result result;
+                if(!measureInChild(distribution, pointsAmount, settings, result)) {
+                    std::fprintf(table, "%-10s %12lu %12s\n", distribution.name, pointsAmount, "failed");
+                    break;
+                }
+
+                double pointsPerSecond = pointsAmount / result.seconds;
+                std::fprintf(table, "%-10s %12lu %12.6f %14.0f %10lu %12.1f %12.1f\n",
+                             distribution.name, pointsAmount, result.seconds, pointsPerSecond, result.hullVertices,
+                             result.inputBytes / 1048576.0, result.peakBytes / 1048576.0);
+                std::fflush(table);
+
+                char entry[512];
+                std::snprintf(entry, sizeof(entry),
+                              "%s\n    { \"input\": \"%s\", \"points\": %lu, \"seconds\": %.9f, \"repetitions\": %u, "
+                              "\"points_per_second\": %.1f, \"hull_vertices\": %lu, \"hull_triangles\": %lu, "
+                              "\"input_bytes\": %lu, \"peak_bytes\": %lu }",
+                              firstEntry ? "" : ",", distribution.name, pointsAmount, result.seconds,
+                              result.repetitions, pointsPerSecond, result.hullVertices, result.hullTriangles,
+                              result.inputBytes, result.peakBytes);
+                json += entry;
+                firstEntry = false;
+
+                /* The next input is ten times larger and takes at least about ten times longer */
+                if(10.0 * result.seconds > settings.timeLimit) { break; }
+            }
+        }
+
+        json += "\n  ]\n}\n";
+
+        if(settings.jsonPath == "-") {
+            std::cout << json;
+        } else if(!settings.jsonPath.empty()) {
+            FILE* file = std::fopen(settings.jsonPath.c_str(), "w");
+            if(file == nullptr) {
+                throw std::runtime_error("Failed to open " + settings.jsonPath + ".");
+            }
+            std::fputs(json.c_str(), file);
+            std::fclose(file);
+        }
+    } catch(const std::exception& exception) {
+        std::cerr << "ERROR : " << exception.what() << '\n';
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/***************************************************************************************************
+ * @file  Arena.cpp
+ * @brief Implementation of the Arena class
+ **************************************************************************************************/
+
+#include "hull/Arena.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <new>
+
+Arena::Arena() : used(0), freeLists{} { }
+
+Arena::~Arena() {
+    for(const Block& block : blocks) {
+        std::free(block.memory);
+    }
+}
+
+void Arena::reset() {
+    std::fill(freeLists, freeLists + SIZE_CLASSES_AMOUNT, nullptr);
+    used = 0;
+
+    if(blocks.size() > 1) {
+        std::size_t capacity = getCapacity();
+
+        for(const Block& block : blocks) {
+            std::free(block.memory);
+        }
+        blocks.clear();
+
+        addBlock(capacity);
+    }
+}
+
+std::size_t Arena::getCapacity() const {
+    std::size_t capacity = 0;
+    for(const Block& block : blocks) {
+        capacity += block.size;
+    }
+
+    return capacity;
+}
+
+void* Arena::allocateBytes(std::size_t size) {
+    uint sizeClass = getSizeClass(size);
+
+    /* Released allocations store the next one of their free list in their first bytes */
+    if(freeLists[sizeClass] != nullptr) {
+        void* memory = freeLists[sizeClass];
+        freeLists[sizeClass] = *static_cast<void**>(memory);
+        return memory;
+    }
+
+    std::size_t classSize = std::size_t(16) << sizeClass;
+    if(blocks.empty() || used + classSize > blocks.back().size) {
+        addBlock(blocks.empty() ? classSize : std::max(classSize, 2 * blocks.back().size));
+    }
+
+    void* memory = blocks.back().memory + used;
+    used += classSize;
+
+    return memory;
+}
+
+void Arena::releaseBytes(void* memory, std::size_t size) {
+    uint sizeClass = getSizeClass(size);
+
+    *static_cast<void**>(memory) = freeLists[sizeClass];
+    freeLists[sizeClass] = memory;
+}
+
+void Arena::addBlock(std::size_t size) {
+    size = std::max(size, MIN_BLOCK_SIZE);
+    size = (size + 63) / 64 * 64;
+
+    void* memory = std::aligned_alloc(64, size);
+    if(memory == nullptr) { throw std::bad_alloc(); }
+
+    blocks.push_back(Block{ static_cast<char*>(memory), size });
+    used = 0;
+}
+
+uint Arena::getSizeClass(std::size_t size) {
+    return std::bit_width((std::max(size, std::size_t(16)) - 1) >> 4);
+}
@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * @file  HalfEdgeMesh.cpp
+ * @brief Implementation of the HalfEdgeMesh class
+ **************************************************************************************************/
+
+#include "hull/HalfEdgeMesh.hpp"
+
+HalfEdgeMesh::HalfEdgeMesh() : removedAmount(0) { }
+
+void HalfEdgeMesh::clear() {
+    origins.clear();
+    twins.clear();
+    removed.clear();
+    removedAmount = 0;
+}
+
+uint HalfEdgeMesh::addFace(uint A, uint B, uint C) {
+    origins.push_back(A);
+    origins.push_back(B);
+    origins.push_back(C);
+
+    twins.push_back(NONE);
+    twins.push_back(NONE);
+    twins.push_back(NONE);
+
+    removed.push_back(false);
+
+    return removed.size() - 1;
+}
+
+void HalfEdgeMesh::removeFace(uint face) {
+    removed[face] = true;
+    ++removedAmount;
+}
+
+void HalfEdgeMesh::compact(std::vector<uint>& faces) {
+    faces.assign(removed.size(), NONE);
+    uint facesAmount = 0;
+
+    for(uint i = 0 ; i < removed.size() ; ++i) {
+        if(!removed[i]) { faces[i] = facesAmount++; }
+    }
+
+    /* Faces only move towards the beginning, so a face is never overwritten before it is moved */
+    for(uint i = 0 ; i < removed.size() ; ++i) {
+        if(faces[i] == NONE) { continue; }
+
+        for(uint k = 0 ; k < 3 ; ++k) {
+            uint twin = twins[3 * i + k];
+            origins[3 * faces[i] + k] = origins[3 * i + k];
+            twins[3 * faces[i] + k] = twin == NONE ? NONE : 3 * faces[twin / 3] + twin % 3;
+        }
+    }
+
+    origins.resize(3 * facesAmount);
+    twins.resize(3 * facesAmount);
+    removed.assign(facesAmount, false);
+    removedAmount = 0;
+}
+
+void HalfEdgeMesh::link(uint edge, uint twin) {
+    twins[edge] = twin;
+    twins[twin] = edge;
+}
+
+uint HalfEdgeMesh::getFacesAmount() const {
+    return removed.size();
+}
+
+uint HalfEdgeMesh::getRemovedAmount() const {
+    return removedAmount;
+}
+
+bool HalfEdgeMesh::isRemoved(uint face) const {
+    return removed[face];
+}
+
+uint HalfEdgeMesh::getEdge(uint face, uint k) const {
+    return 3 * face + k;
+}
+
+uint HalfEdgeMesh::getVertex(uint face, uint k) const {
+    return origins[3 * face + k];
+}
+
+uint HalfEdgeMesh::getNeighbour(uint face, uint k) const {
+    uint twin = twins[3 * face + k];
+    return twin == NONE ? NONE : twin / 3;
+}
+
+uint HalfEdgeMesh::getFace(uint edge) const {
+    return edge / 3;
+}
+
+uint HalfEdgeMesh::getNext(uint edge) const {
+    return edge % 3 == 2 ? edge - 2 : edge + 1;
+}
+
+uint HalfEdgeMesh::getPrevious(uint edge) const {
+    return edge % 3 == 0 ? edge + 2 : edge - 1;
+}
+
+uint HalfEdgeMesh::getTwin(uint edge) const {
+    return twins[edge];
+}
+
+uint HalfEdgeMesh::getOrigin(uint edge) const {
+    return origins[edge];
+}
+
+uint HalfEdgeMesh::getDestination(uint edge) const {
+    return origins[getNext(edge)];
+}
@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ * @file  MappedCloud.cpp
+ * @brief Implementation of the MappedCloud class
+ **************************************************************************************************/
+
+#include "hull/MappedCloud.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    /* Headers longer than this are not searched for their end */
+    constexpr std::size_t MAX_HEADER_SIZE = 1 << 20;
+
+    /* An element of a PLY header, the offsets and types are the ones of its x, y and z properties */
+    struct PlyElement {
+        std::string name;
+        uint64_t count = 0;
+        std::size_t recordSize = 0;
+        bool hasList = false;
+        std::size_t offsets[3] = { 0, 0, 0 };
+        std::string types[3];
+    };
+
+    /* Size in bytes of a PLY scalar type, 0 for unknown types */
+    std::size_t getTypeSize(const std::string& type) {
+        if(type == "char" || type == "uchar" || type == "int8" || type == "uint8") { return 1; }
+        if(type == "short" || type == "ushort" || type == "int16" || type == "uint16") { return 2; }
+        if(type == "int" || type == "uint" || type == "int32" || type == "uint32" || type == "float" || type == "float32") { return 4; }
+        if(type == "double" || type == "float64") { return 8; }
+        return 0;
+    }
+
+    /* Moves an offset past the records of an element, false when they do not all fit before the end of the
+     * file. The product of the count and the record size is only computed once it is known not to overflow */
+    bool skipRecords(std::size_t& offset, uint64_t count, std::size_t recordSize, std::size_t size) {
+        if(recordSize != 0 && count > (size - offset) / recordSize) { return false; }
+
+        offset += count * recordSize;
+        return true;
+    }
+}
+
+MappedCloud::MappedCloud(const std::string& path)
+    : memory(nullptr), size(0), x(nullptr), y(nullptr), z(nullptr), stride(0), pointsAmount(0), doublePrecision(false) {
+    if constexpr(std::endian::native != std::endian::little) {
+        throw std::runtime_error("Binary point clouds can only be mapped on little-endian machines.");
+    }
+
+    int file = open(path.c_str(), O_RDONLY);
+    if(file < 0) {
+        throw std::runtime_error("Failed to open " + path + ".");
+    }
+
+    struct stat status;
+    if(fstat(file, &status) != 0 || status.st_size == 0) {
+        close(file);
+        throw std::runtime_error("Failed to read the size of " + path + ".");
+    }
+    size = status.st_size;
+
+    /* The mapping keeps the file open, the descriptor is not needed anymore */
+    memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if(memory == MAP_FAILED) {
+        memory = nullptr;
+        throw std::runtime_error("Failed to map " + path + ".");
+    }
+
+    /* The hull scans the points from the first to the last, the kernel can read ahead and drop the
+     * pages behind the scan */
+    madvise(memory, size, MADV_SEQUENTIAL);
+
+    try {
+        /* PLY files written on Windows end their header lines with \r\n */
+        std::string_view start(static_cast<const char*>(memory), std::min<std::size_t>(size, 5));
+        if(start.starts_with("ply\n") || start.starts_with("ply\r\n")) {
+            parsePlyHeader();
+        } else {
+            if(size % (3 * sizeof(float)) != 0) {
+                throw std::runtime_error("The size of " + path + " is not a multiple of 3 floats.");
+            }
+            if(size / (3 * sizeof(float)) > UINT_MAX) {
+                throw std::runtime_error(path + " has too many points.");
+            }
+
+            x = static_cast<const unsigned char*>(memory);
+            y = x + sizeof(float);
+            z = x + 2 * sizeof(float);
+            stride = 3 * sizeof(float);
+            pointsAmount = size / (3 * sizeof(float));
+        }
+    } catch(...) {
+        munmap(memory, size);
+        throw;
+    }
+}
+
+MappedCloud::~MappedCloud() {
+    munmap(memory, size);
+}
+
+template<typename Scalar>
+PointView<Scalar> MappedCloud::getView() const {
+    if(doublePrecision != std::is_same_v<Scalar, double>) {
+        throw std::runtime_error(std::string("The coordinates of the cloud are stored as ") + (doublePrecision ? "double." : "float."));
+    }
+
+    return PointView<Scalar>(x, y, z, stride, pointsAmount);
+}
+
+template PointView<float> MappedCloud::getView<float>() const;
+template PointView<double> MappedCloud::getView<double>() const;
+
+uint MappedCloud::getPointsAmount() const {
+    return pointsAmount;
+}
+
+bool MappedCloud::isDoublePrecision() const {
+    return doublePrecision;
+}
+
+void MappedCloud::parsePlyHeader() {
+    std::string_view content(static_cast<const char*>(memory), std::min(size, MAX_HEADER_SIZE));
+    std::size_t headerEnd = content.find("end_header");
+    std::size_t dataEnd = headerEnd == std::string_view::npos ? headerEnd : content.find('\n', headerEnd);
+    if(dataEnd == std::string_view::npos) {
+        throw std::runtime_error("The PLY header has no end.");
+    }
+
+    std::vector<PlyElement> elements;
+    std::istringstream header{ std::string(content.substr(0, headerEnd)) };
+    std::string line;
+
+    while(std::getline(header, line)) {
+        if(!line.empty() && line.back() == '\r') { line.pop_back(); }
+
+        std::istringstream words(line);
+        std::string keyword;
+        words >> keyword;
+
+        if(keyword == "format") {
+            std::string format;
+            words >> format;
+            if(format != "binary_little_endian") {
+                throw std::runtime_error("Only binary little-endian PLY files can be mapped, not " + format + ".");
+            }
+        } else if(keyword == "element") {
+            elements.emplace_back();
+            words >> elements.back().name >> elements.back().count;
+        } else if(keyword == "property" && !elements.empty()) {
+            PlyElement& element = elements.back();
+            std::string type;
+            std::string name;
+            words >> type >> name;
+
+            if(type == "list") {
+                element.hasList = true;
+                continue;
+            }
+
+            std::size_t typeSize = getTypeSize(type);
+            if(typeSize == 0) {
+                throw std::runtime_error("Unknown PLY property type " + type + ".");
+            }
+
+            if(name.size() == 1 && name[0] >= 'x' && name[0] <= 'z') {
+                element.offsets[name[0] - 'x'] = element.recordSize;
+                element.types[name[0] - 'x'] = type;
+            }
+            element.recordSize += typeSize;
+        }
+    }
+
+    /* The vertices come after the elements declared before them, which must have records of fixed size */
+    std::size_t verticesBegin = dataEnd + 1;
+    auto vertices = elements.begin();
+    for( ; vertices != elements.end() && vertices->name != "vertex" ; ++vertices) {
+        if(vertices->hasList) {
+            throw std::runtime_error("The elements before the vertices of a PLY file cannot have list properties.");
+        }
+        if(!skipRecords(verticesBegin, vertices->count, vertices->recordSize, size)) {
+            throw std::runtime_error("The PLY file is shorter than its header says.");
+        }
+    }
+
+    if(vertices == elements.end() || vertices->types[0].empty() || vertices->types[1].empty() || vertices->types[2].empty()) {
+        throw std::runtime_error("The PLY file has no vertex with x, y and z properties.");
+    }
+
+    if(vertices->hasList) {
+        throw std::runtime_error("The vertices of a PLY file cannot have list properties.");
+    }
+
+    const std::string& type = vertices->types[0];
+    if(vertices->types[1] != type || vertices->types[2] != type || (type != "float" && type != "float32" && type != "double" && type != "float64")) {
+        throw std::runtime_error("The coordinates of the PLY vertices must all be float or all be double.");
+    }
+
+    if(vertices->count > UINT_MAX) {
+        throw std::runtime_error("The PLY file has too many vertices.");
+    }
+
+    std::size_t verticesEnd = verticesBegin;
+    if(!skipRecords(verticesEnd, vertices->count, vertices->recordSize, size)) {
+        throw std::runtime_error("The PLY file is shorter than its header says.");
+    }
+
+    const unsigned char* records = static_cast<const unsigned char*>(memory) + verticesBegin;
+    x = records + vertices->offsets[0];
+    y = records + vertices->offsets[1];
+    z = records + vertices->offsets[2];
+    stride = vertices->recordSize;
+    pointsAmount = vertices->count;
+    doublePrecision = getTypeSize(type) == 8;
+}
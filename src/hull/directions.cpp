@@ -0,0 +1,47 @@
+/***************************************************************************************************
+ * @file  directions.cpp
+ * @brief Implementation of functions to create sets of directions
+ **************************************************************************************************/
+
+#include "hull/directions.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+std::vector<vec3> Directions::lattice(uint amount) {
+    static const vec3 directions[26]{
+        vec3(1.0f, 0.0f, 0.0f), vec3(-1.0f, 0.0f, 0.0f),
+        vec3(0.0f, 1.0f, 0.0f), vec3(0.0f, -1.0f, 0.0f),
+        vec3(0.0f, 0.0f, 1.0f), vec3(0.0f, 0.0f, -1.0f),
+
+        vec3(1.0f, 1.0f, 1.0f), vec3(-1.0f, -1.0f, -1.0f),
+        vec3(1.0f, 1.0f, -1.0f), vec3(-1.0f, -1.0f, 1.0f),
+        vec3(1.0f, -1.0f, 1.0f), vec3(-1.0f, 1.0f, -1.0f),
+        vec3(-1.0f, 1.0f, 1.0f), vec3(1.0f, -1.0f, -1.0f),
+
+        vec3(1.0f, 1.0f, 0.0f), vec3(-1.0f, -1.0f, 0.0f),
+        vec3(1.0f, -1.0f, 0.0f), vec3(-1.0f, 1.0f, 0.0f),
+        vec3(1.0f, 0.0f, 1.0f), vec3(-1.0f, 0.0f, -1.0f),
+        vec3(1.0f, 0.0f, -1.0f), vec3(-1.0f, 0.0f, 1.0f),
+        vec3(0.0f, 1.0f, 1.0f), vec3(0.0f, -1.0f, -1.0f),
+        vec3(0.0f, 1.0f, -1.0f), vec3(0.0f, -1.0f, 1.0f)
+    };
+
+    return std::vector<vec3>(directions, directions + std::min(amount, 26u));
+}
+
+std::vector<vec3> Directions::hemisphere(uint amount) {
+    /* Consecutive directions turn by the golden angle while their height goes down by even steps */
+    const double goldenAngle = M_PI * (3.0 - std::sqrt(5.0));
+    std::vector<vec3> directions;
+    directions.reserve(amount);
+
+    for(uint i = 0 ; i < amount ; ++i) {
+        double z = 1.0 - (i + 0.5) / amount;
+        double radius = std::sqrt(1.0 - z * z);
+        double angle = goldenAngle * i;
+        directions.emplace_back(radius * std::cos(angle), radius * std::sin(angle), z);
+    }
+
+    return directions;
+}
@@ -0,0 +1,189 @@
+/***************************************************************************************************
+ * @file  exporters.cpp
+ * @brief Implementation of functions to save hulls as indexed meshes
+ **************************************************************************************************/
+
+#include "hull/exporters.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include "maths/geometry.hpp"
+
+namespace {
+    /* Size of the header of binary STL files, which is not interpreted */
+    constexpr std::size_t STL_HEADER_SIZE = 80;
+
+    /* Appends the bytes of a value, the files are little-endian like the machine */
+    template<typename Value>
+    void appendBytes(std::vector<char>& buffer, const Value& value) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(Value));
+    }
+
+    void appendText(std::vector<char>& buffer, std::string_view text) {
+        buffer.insert(buffer.end(), text.begin(), text.end());
+    }
+
+    /* Appends the shortest text that reads back as the same number */
+    template<typename Number>
+    void appendNumber(std::vector<char>& buffer, Number number) {
+        char digits[32];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), number);
+        buffer.insert(buffer.end(), digits, result.ptr);
+    }
+
+    template<typename Scalar>
+    std::vector<char> formatPly(const std::vector<tvec3<Scalar>>& vertices, const std::vector<uint>& triangles) {
+        const char* type = std::is_same_v<Scalar, double> ? "double" : "float";
+        std::string header = "ply\nformat binary_little_endian 1.0\nelement vertex " + std::to_string(vertices.size())
+                           + "\nproperty " + type + " x\nproperty " + type + " y\nproperty " + type + " z\nelement face "
+                           + std::to_string(triangles.size() / 3) + "\nproperty list uchar uint vertex_indices\nend_header\n";
+
+        std::vector<char> buffer;
+        buffer.reserve(header.size() + vertices.size() * 3 * sizeof(Scalar) + triangles.size() / 3 * (1 + 3 * sizeof(uint32_t)));
+        appendText(buffer, header);
+
+        for(const tvec3<Scalar>& vertex : vertices) {
+            appendBytes(buffer, vertex.x);
+            appendBytes(buffer, vertex.y);
+            appendBytes(buffer, vertex.z);
+        }
+
+        for(uint i = 0 ; i < triangles.size() ; i += 3) {
+            appendBytes(buffer, static_cast<uint8_t>(3));
+            appendBytes(buffer, static_cast<uint32_t>(triangles[i]));
+            appendBytes(buffer, static_cast<uint32_t>(triangles[i + 1]));
+            appendBytes(buffer, static_cast<uint32_t>(triangles[i + 2]));
+        }
+
+        return buffer;
+    }
+
+    template<typename Scalar>
+    std::vector<char> formatObj(const std::vector<tvec3<Scalar>>& vertices, const std::vector<uint>& triangles) {
+        std::vector<char> buffer;
+        buffer.reserve(vertices.size() * 40 + triangles.size() * 8);
+
+        for(const tvec3<Scalar>& vertex : vertices) {
+            appendText(buffer, "v ");
+            appendNumber(buffer, vertex.x);
+            appendText(buffer, " ");
+            appendNumber(buffer, vertex.y);
+            appendText(buffer, " ");
+            appendNumber(buffer, vertex.z);
+            appendText(buffer, "\n");
+        }
+
+        /* OBJ indices start at 1 */
+        for(uint i = 0 ; i < triangles.size() ; i += 3) {
+            appendText(buffer, "f ");
+            appendNumber(buffer, triangles[i] + 1);
+            appendText(buffer, " ");
+            appendNumber(buffer, triangles[i + 1] + 1);
+            appendText(buffer, " ");
+            appendNumber(buffer, triangles[i + 2] + 1);
+            appendText(buffer, "\n");
+        }
+
+        return buffer;
+    }
+
+    template<typename Scalar>
+    std::vector<char> formatStl(const std::vector<tvec3<Scalar>>& vertices, const std::vector<uint>& triangles) {
+        std::vector<char> buffer(STL_HEADER_SIZE, 0);
+        buffer.reserve(STL_HEADER_SIZE + sizeof(uint32_t) + triangles.size() / 3 * (12 * sizeof(float) + sizeof(uint16_t)));
+        appendBytes(buffer, static_cast<uint32_t>(triangles.size() / 3));
+
+        auto appendPoint = [&buffer](const tvec3<Scalar>& point) {
+            appendBytes(buffer, static_cast<float>(point.x));
+            appendBytes(buffer, static_cast<float>(point.y));
+            appendBytes(buffer, static_cast<float>(point.z));
+        };
+
+        for(uint i = 0 ; i < triangles.size() ; i += 3) {
+            const tvec3<Scalar>& A = vertices[triangles[i]];
+            const tvec3<Scalar>& B = vertices[triangles[i + 1]];
+            const tvec3<Scalar>& C = vertices[triangles[i + 2]];
+
+            /* Degenerate triangles get a null normal rather than a NaN one */
+            tvec3<Scalar> normal = cross(B - A, C - A);
+            Scalar normalLength = length(normal);
+            appendPoint(normalLength > 0 ? normal / normalLength : tvec3<Scalar>());
+
+            appendPoint(A);
+            appendPoint(B);
+            appendPoint(C);
+            appendBytes(buffer, static_cast<uint16_t>(0));
+        }
+
+        return buffer;
+    }
+
+    template<typename Scalar>
+    void saveMesh(const std::string& path, const std::vector<tvec3<Scalar>>& vertices, const std::vector<uint>& triangles) {
+        if constexpr(std::endian::native != std::endian::little) {
+            throw std::runtime_error("Binary meshes can only be saved on little-endian machines.");
+        }
+
+        if(triangles.size() % 3 != 0) {
+            throw std::runtime_error("The amount of triangle indices is not a multiple of 3.");
+        }
+
+        if(std::any_of(triangles.begin(), triangles.end(), [&vertices](uint index) { return index >= vertices.size(); })) {
+            throw std::runtime_error("A triangle index is not the index of a vertex.");
+        }
+
+        std::vector<char> buffer;
+        switch(Exporters::getFormat(path)) {
+            case Exporters::Format::Ply:
+                buffer = formatPly(vertices, triangles);
+                break;
+            case Exporters::Format::Obj:
+                buffer = formatObj(vertices, triangles);
+                break;
+            case Exporters::Format::Stl:
+                buffer = formatStl(vertices, triangles);
+                break;
+        }
+
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if(file == nullptr) {
+            throw std::runtime_error("Failed to open " + path + ".");
+        }
+
+        std::size_t written = std::fwrite(buffer.data(), 1, buffer.size(), file);
+        if(std::fclose(file) != 0 || written != buffer.size()) {
+            throw std::runtime_error("Failed to write " + path + ".");
+        }
+    }
+}
+
+Exporters::Format Exporters::getFormat(const std::string& path) {
+    std::size_t dot = path.find_last_of('.');
+    std::string extension = dot == std::string::npos ? "" : path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char character) {
+        return std::tolower(character);
+    });
+
+    if(extension == "ply") { return Format::Ply; }
+    if(extension == "obj") { return Format::Obj; }
+    if(extension == "stl") { return Format::Stl; }
+
+    throw std::runtime_error("Unknown mesh extension: " + extension);
+}
+
+void Exporters::save(const std::string& path, const std::vector<vec3>& vertices, const std::vector<uint>& triangles) {
+    saveMesh(path, vertices, triangles);
+}
+
+void Exporters::save(const std::string& path, const std::vector<dvec3>& vertices, const std::vector<uint>& triangles) {
+    saveMesh(path, vertices, triangles);
+}
@@ -0,0 +1,284 @@
+/***************************************************************************************************
+ * @file  generators.cpp
+ * @brief Implementation of functions to generate point clouds
+ **************************************************************************************************/
+
+#include "hull/generators.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define GENERATORS_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+    #define GENERATORS_CLONES
+#endif
+
+namespace {
+    /* Points are generated by blocks of fixed length so every loop below gets vectorized */
+    constexpr uint BLOCK_SIZE = 64;
+    constexpr uint MIN_POINTS_PER_THREAD = 1 << 16;
+
+    constexpr uint CLUSTERS_AMOUNT = 16;
+    constexpr float CLUSTER_DEVIATION = 0.05f;
+    constexpr float TWO_PI = 6.28318530717958647692f;
+
+    /* Third word of the counter, so the cluster centers do not reuse the random numbers of the points */
+    constexpr uint32_t POINTS_STREAM = 0;
+    constexpr uint32_t CENTERS_STREAM = 1;
+
+    /* Philox4x32-10 of the counters (first + j, stream), 4 random words per counter */
+    inline void philox(uint64_t first, uint32_t stream, uint64_t seed, uint32_t (&words)[4][BLOCK_SIZE]) {
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            uint64_t counter = first + j;
+            words[0][j] = static_cast<uint32_t>(counter);
+            words[1][j] = static_cast<uint32_t>(counter >> 32);
+            words[2][j] = stream;
+            words[3][j] = 0;
+        }
+
+        uint32_t key0 = static_cast<uint32_t>(seed);
+        uint32_t key1 = static_cast<uint32_t>(seed >> 32);
+
+        for(uint round = 0 ; round < 10 ; ++round) {
+            for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * words[0][j];
+                uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * words[2][j];
+
+                uint32_t word0 = static_cast<uint32_t>(product1 >> 32) ^ words[1][j] ^ key0;
+                uint32_t word2 = static_cast<uint32_t>(product0 >> 32) ^ words[3][j] ^ key1;
+                words[1][j] = static_cast<uint32_t>(product1);
+                words[3][j] = static_cast<uint32_t>(product0);
+                words[0][j] = word0;
+                words[2][j] = word2;
+            }
+
+            key0 += 0x9E3779B9u;
+            key1 += 0xBB67AE85u;
+        }
+    }
+
+    /* The 24 upper bits of a word, scaled to [0, 1) */
+    inline float toUniform(uint32_t word) {
+        return static_cast<float>(word >> 8) * 0x1p-24f;
+    }
+
+    /* The 24 upper bits of a word, scaled to (0, 1] so their logarithm is finite */
+    inline float toOpenUniform(uint32_t word) {
+        return static_cast<float>((word >> 8) + 1) * 0x1p-24f;
+    }
+
+    /* The maths functions below replace the ones of the library, whose vector versions used by the AVX2 clone
+     * do not round like the scalar ones, so the same seed gives the same points on every processor. They
+     * only use basic operations and are inlined in loops that get vectorized */
+
+    /* Natural logarithm of a positive normal value, from its exponent and the series of atanh for its
+     * mantissa taken in [sqrt(2) / 2, sqrt(2)) */
+    inline float logarithm(float value) {
+        uint32_t bits = std::bit_cast<uint32_t>(value);
+        int exponent = static_cast<int>(bits >> 23) - 127;
+        float mantissa = std::bit_cast<float>((bits & 0x7FFFFFu) | 0x3F800000u);
+
+        bool large = mantissa > 1.41421356f;
+        mantissa = large ? 0.5f * mantissa : mantissa;
+        exponent = large ? exponent + 1 : exponent;
+
+        float f = (mantissa - 1.0f) / (mantissa + 1.0f);
+        float f2 = f * f;
+        float series = f * (2.0f + f2 * (2.0f / 3.0f + f2 * (2.0f / 5.0f + f2 * (2.0f / 7.0f + f2 * (2.0f / 9.0f)))));
+
+        return static_cast<float>(exponent) * 0.693147181f + series;
+    }
+
+    /* Cube root of a value of [0, 1], from an estimate of its bits refined by Newton's method */
+    inline float cubeRoot(float value) {
+        float root = std::bit_cast<float>(std::bit_cast<uint32_t>(value) / 3 + 709958130u);
+
+        /* Each step about doubles the amount of correct bits, written out so the loops calling it get vectorized */
+        root = (2.0f * root + value / (root * root)) / 3.0f;
+        root = (2.0f * root + value / (root * root)) / 3.0f;
+        root = (2.0f * root + value / (root * root)) / 3.0f;
+
+        return value > 0.0f ? root : 0.0f;
+    }
+
+    /* Cosine and sine of a fraction of a turn of [0, 1]. The turn is cut in quadrants so the Taylor series
+     * only cover angles of [-pi / 4, pi / 4] */
+    inline void turnCosSin(float turn, float& cosine, float& sine) {
+        uint quadrant = static_cast<uint>(4.0f * turn + 0.5f);
+        float angle = TWO_PI * (turn - 0.25f * static_cast<float>(quadrant));
+        float a2 = angle * angle;
+
+        float c = 1.0f + a2 * (-1.0f / 2.0f + a2 * (1.0f / 24.0f + a2 * (-1.0f / 720.0f + a2 * (1.0f / 40320.0f))));
+        float s = angle * (1.0f + a2 * (-1.0f / 6.0f + a2 * (1.0f / 120.0f + a2 * (-1.0f / 5040.0f + a2 * (1.0f / 362880.0f)))));
+
+        /* A quarter turn maps (cos, sin) to (-sin, cos) */
+        float first = (quadrant & 1) != 0 ? s : c;
+        float second = (quadrant & 1) != 0 ? c : s;
+        cosine = ((quadrant + 1) & 2) != 0 ? -first : first;
+        sine = (quadrant & 2) != 0 ? -second : second;
+    }
+
+    /* Pairs of standard normal values with the Box-Muller transform. Inlined like directions, otherwise the
+     * AVX2 clone of generateBlock would call a version compiled without AVX2 */
+    __attribute__((always_inline)) inline void normals(const uint32_t* radiusWords, const uint32_t* angleWords,
+                                                       float* __restrict first, float* __restrict second) {
+        float radiuses[BLOCK_SIZE];
+        float cosines[BLOCK_SIZE];
+        float sines[BLOCK_SIZE];
+
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            radiuses[j] = std::sqrt(-2.0f * logarithm(toOpenUniform(radiusWords[j])));
+            turnCosSin(toUniform(angleWords[j]), cosines[j], sines[j]);
+        }
+
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            first[j] = radiuses[j] * cosines[j];
+        }
+
+        if(second == nullptr) { return; }
+
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            second[j] = radiuses[j] * sines[j];
+        }
+    }
+
+    /* Unit vectors with a uniform height and a uniform angle around the z axis */
+    __attribute__((always_inline)) inline void directions(const uint32_t* heightWords, const uint32_t* angleWords,
+                                                          float* __restrict x, float* __restrict y, float* __restrict z) {
+        for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+            z[j] = 2.0f * toUniform(heightWords[j]) - 1.0f;
+            float radius = std::sqrt(std::max(1.0f - z[j] * z[j], 0.0f));
+
+            float cosine;
+            float sine;
+            turnCosSin(toUniform(angleWords[j]), cosine, sine);
+            x[j] = radius * cosine;
+            y[j] = radius * sine;
+        }
+    }
+
+    /* Generates the points first to first + BLOCK_SIZE - 1, compiled for AVX2 as well so the loops use 8
+     * lanes when the processor supports them. The coordinates do not overlap, so the loops writing several
+     * of them are vectorized without checking it first */
+    GENERATORS_CLONES
+    void generateBlock(Generators::Distribution distribution, uint64_t first, uint64_t seed, const vec3* centers,
+                       float* __restrict x, float* __restrict y, float* __restrict z) {
+        uint32_t words[4][BLOCK_SIZE];
+        philox(first, POINTS_STREAM, seed, words);
+
+        switch(distribution) {
+            case Generators::Distribution::Cube:
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    x[j] = 2.0f * toUniform(words[0][j]) - 1.0f;
+                    y[j] = 2.0f * toUniform(words[1][j]) - 1.0f;
+                    z[j] = 2.0f * toUniform(words[2][j]) - 1.0f;
+                }
+                break;
+
+            case Generators::Distribution::Ball: {
+                float radiuses[BLOCK_SIZE];
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    radiuses[j] = cubeRoot(toUniform(words[2][j]));
+                }
+
+                directions(words[0], words[1], x, y, z);
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    x[j] *= radiuses[j];
+                    y[j] *= radiuses[j];
+                    z[j] *= radiuses[j];
+                }
+                break;
+            }
+
+            case Generators::Distribution::Sphere:
+                directions(words[0], words[1], x, y, z);
+                break;
+
+            case Generators::Distribution::Gaussian:
+                normals(words[0], words[1], x, y);
+                normals(words[2], words[3], z, nullptr);
+                break;
+
+            case Generators::Distribution::Clustered:
+                normals(words[0], words[1], x, y);
+                normals(words[2], words[3], z, nullptr);
+
+                /* The lower bits of the last word are not used by the normal values */
+                for(uint j = 0 ; j < BLOCK_SIZE ; ++j) {
+                    const vec3& center = centers[words[3][j] % CLUSTERS_AMOUNT];
+                    x[j] = center.x + CLUSTER_DEVIATION * x[j];
+                    y[j] = center.y + CLUSTER_DEVIATION * y[j];
+                    z[j] = center.z + CLUSTER_DEVIATION * z[j];
+                }
+                break;
+        }
+    }
+
+    template<typename Scalar>
+    void generatePoints(tvec3<Scalar>* points, uint64_t count, Generators::Distribution distribution, uint64_t seed, uint threadsAmount) {
+        if(threadsAmount == 0) {
+            threadsAmount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        threadsAmount = std::max<uint64_t>(std::min<uint64_t>(threadsAmount, count / MIN_POINTS_PER_THREAD), 1);
+
+        /* The cluster centers come from their own stream so they do not depend on the amount of points */
+        vec3 centers[CLUSTERS_AMOUNT];
+        if(distribution == Generators::Distribution::Clustered) {
+            uint32_t words[4][BLOCK_SIZE];
+            philox(0, CENTERS_STREAM, seed, words);
+
+            for(uint c = 0 ; c < CLUSTERS_AMOUNT ; ++c) {
+                centers[c] = vec3(2.0f * toUniform(words[0][c]) - 1.0f, 2.0f * toUniform(words[1][c]) - 1.0f,
+                                  2.0f * toUniform(words[2][c]) - 1.0f);
+            }
+        }
+
+        /* Each thread handles a contiguous range of whole blocks */
+        uint64_t blocksAmount = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        auto generateRange = [points, count, distribution, seed, &centers, blocksAmount, threadsAmount](uint thread) {
+            float x[BLOCK_SIZE];
+            float y[BLOCK_SIZE];
+            float z[BLOCK_SIZE];
+
+            uint64_t endBlock = blocksAmount * (thread + 1) / threadsAmount;
+            for(uint64_t block = blocksAmount * thread / threadsAmount ; block < endBlock ; ++block) {
+                uint64_t first = block * BLOCK_SIZE;
+                generateBlock(distribution, first, seed, centers, x, y, z);
+
+                uint blockCount = std::min<uint64_t>(BLOCK_SIZE, count - first);
+                for(uint j = 0 ; j < blockCount ; ++j) {
+                    points[first + j] = tvec3<Scalar>(x[j], y[j], z[j]);
+                }
+            }
+        };
+
+        if(threadsAmount == 1) {
+            generateRange(0);
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadsAmount);
+
+        for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+            threads.emplace_back(generateRange, thread);
+        }
+
+        for(std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+void Generators::generate(vec3* points, uint64_t count, Distribution distribution, uint64_t seed, uint threadsAmount) {
+    generatePoints(points, count, distribution, seed, threadsAmount);
+}
+
+void Generators::generate(dvec3* points, uint64_t count, Distribution distribution, uint64_t seed, uint threadsAmount) {
+    generatePoints(points, count, distribution, seed, threadsAmount);
+}
@@ -0,0 +1,494 @@
+/***************************************************************************************************
+ * @file  kernels.cpp
+ * @brief Implementation of the SIMD kernels testing points against planes and directions
+ **************************************************************************************************/
+
+#include "hull/kernels.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define KERNELS_X86
+#endif
+
+#ifdef __FAST_MATH__
+    #error "kernels.cpp must be compiled without -ffast-math"
+#endif
+
+namespace {
+    /* ---- Scalar ---- */
+
+    template<typename Scalar>
+    uint distancesScalar(const PointCloud<Scalar>& cloud, const uint* indices, uint count, const Plane<Scalar>& plane, Scalar* distances) {
+        const Scalar* x = cloud.getX();
+        const Scalar* y = cloud.getY();
+        const Scalar* z = cloud.getZ();
+
+        uint farthest = 0;
+        for(uint i = 0 ; i < count ; ++i) {
+            uint index = indices[i];
+            distances[i] = plane.normal.x * x[index] + plane.normal.y * y[index] + plane.normal.z * z[index] - plane.offset;
+            if(distances[i] > distances[farthest]) { farthest = i; }
+        }
+
+        return farthest;
+    }
+
+    template<typename Scalar>
+    void projectionBoundsScalar(const Scalar* x, const Scalar* y, const Scalar* z, uint count, const tvec3<Scalar>* directions,
+                                uint directionsAmount, Scalar* maximums, Scalar* minimums) {
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            const tvec3<Scalar>& direction = directions[d];
+            Scalar maximum = direction.x * x[0] + direction.y * y[0] + direction.z * z[0];
+            Scalar minimum = maximum;
+
+            for(uint i = 1 ; i < count ; ++i) {
+                Scalar projection = direction.x * x[i] + direction.y * y[i] + direction.z * z[i];
+                maximum = std::max(maximum, projection);
+                minimum = std::min(minimum, projection);
+            }
+
+            maximums[d] = maximum;
+            minimums[d] = minimum;
+        }
+    }
+
+    /* Merges the lanes of the bounds of a direction with the projections of the points left after the
+     * last full vector, which are handled without SIMD. Inlined so the AVX2 kernels do not switch to
+     * SSE code with the upper halves of the registers in use, which is slow on some processors */
+    template<typename Scalar, uint LANES>
+    __attribute__((always_inline)) inline void reduceBounds(const Scalar (&maximumLanes)[LANES], const Scalar (&minimumLanes)[LANES], const Scalar* x, const Scalar* y,
+                      const Scalar* z, uint begin, uint count, const tvec3<Scalar>& direction, Scalar& maximum, Scalar& minimum) {
+        maximum = *std::max_element(maximumLanes, maximumLanes + LANES);
+        minimum = *std::min_element(minimumLanes, minimumLanes + LANES);
+
+        for(uint i = begin ; i < count ; ++i) {
+            Scalar projection = direction.x * x[i] + direction.y * y[i] + direction.z * z[i];
+            maximum = std::max(maximum, projection);
+            minimum = std::min(minimum, projection);
+        }
+    }
+
+    /* Merges the farthest distance of each lane with the ones of the points left after the last full
+     * vector, which are handled without SIMD */
+    template<typename Scalar, typename Position, uint LANES>
+    uint reduceLanes(const Scalar (&lanes)[LANES], const Position (&lanePositions)[LANES], const PointCloud<Scalar>& cloud,
+                     const uint* indices, uint begin, uint count, const Plane<Scalar>& plane, Scalar* distances) {
+        uint farthest = lanePositions[0];
+        for(uint lane = 1 ; lane < LANES ; ++lane) {
+            if(lanes[lane] > distances[farthest] || (lanes[lane] == distances[farthest] && lanePositions[lane] < farthest)) {
+                farthest = lanePositions[lane];
+            }
+        }
+
+        if(begin == count) { return farthest; }
+
+        uint remaining = begin + distancesScalar(cloud, indices + begin, count - begin, plane, distances + begin);
+        return distances[remaining] > distances[farthest] ? remaining : farthest;
+    }
+
+#ifdef KERNELS_X86
+    /* ---- SSE2 ---- */
+
+    uint distancesSSE2(const PointCloud<float>& cloud, const uint* indices, uint count, const Plane<float>& plane, float* distances) {
+        if(count < 4) { return distancesScalar(cloud, indices, count, plane, distances); }
+
+        const float* x = cloud.getX();
+        const float* y = cloud.getY();
+        const float* z = cloud.getZ();
+
+        __m128 nx = _mm_set1_ps(plane.normal.x);
+        __m128 ny = _mm_set1_ps(plane.normal.y);
+        __m128 nz = _mm_set1_ps(plane.normal.z);
+        __m128 offset = _mm_set1_ps(plane.offset);
+
+        /* Each lane keeps the farthest distance it has seen and where it was in indices, SSE2 has no
+         * blend so the lanes are selected with masks */
+        __m128 best = _mm_set1_ps(-__FLT_MAX__);
+        __m128i bestPosition = _mm_setzero_si128();
+        __m128i position = _mm_setr_epi32(0, 1, 2, 3);
+        const __m128i step = _mm_set1_epi32(4);
+
+        uint i = 0;
+        for( ; i + 4 <= count ; i += 4) {
+            const uint* index = indices + i;
+            __m128 px = _mm_setr_ps(x[index[0]], x[index[1]], x[index[2]], x[index[3]]);
+            __m128 py = _mm_setr_ps(y[index[0]], y[index[1]], y[index[2]], y[index[3]]);
+            __m128 pz = _mm_setr_ps(z[index[0]], z[index[1]], z[index[2]], z[index[3]]);
+
+            __m128 distance = _mm_add_ps(_mm_mul_ps(nx, px), _mm_add_ps(_mm_mul_ps(ny, py), _mm_mul_ps(nz, pz)));
+            distance = _mm_sub_ps(distance, offset);
+            _mm_storeu_ps(distances + i, distance);
+
+            __m128 greater = _mm_cmpgt_ps(distance, best);
+            __m128i greaterMask = _mm_castps_si128(greater);
+            best = _mm_or_ps(_mm_and_ps(greater, distance), _mm_andnot_ps(greater, best));
+            bestPosition = _mm_or_si128(_mm_and_si128(greaterMask, position), _mm_andnot_si128(greaterMask, bestPosition));
+            position = _mm_add_epi32(position, step);
+        }
+
+        float lanes[4];
+        uint lanePositions[4];
+        _mm_storeu_ps(lanes, best);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanePositions), bestPosition);
+
+        return reduceLanes(lanes, lanePositions, cloud, indices, i, count, plane, distances);
+    }
+
+    uint distancesSSE2(const PointCloud<double>& cloud, const uint* indices, uint count, const Plane<double>& plane, double* distances) {
+        if(count < 2) { return distancesScalar(cloud, indices, count, plane, distances); }
+
+        const double* x = cloud.getX();
+        const double* y = cloud.getY();
+        const double* z = cloud.getZ();
+
+        __m128d nx = _mm_set1_pd(plane.normal.x);
+        __m128d ny = _mm_set1_pd(plane.normal.y);
+        __m128d nz = _mm_set1_pd(plane.normal.z);
+        __m128d offset = _mm_set1_pd(plane.offset);
+
+        /* Each lane keeps the farthest distance it has seen and where it was in indices, as a 64 bits integer */
+        __m128d best = _mm_set1_pd(-__DBL_MAX__);
+        __m128i bestPosition = _mm_setzero_si128();
+        __m128i position = _mm_set_epi64x(1, 0);
+        const __m128i step = _mm_set1_epi64x(2);
+
+        uint i = 0;
+        for( ; i + 2 <= count ; i += 2) {
+            const uint* index = indices + i;
+            __m128d px = _mm_setr_pd(x[index[0]], x[index[1]]);
+            __m128d py = _mm_setr_pd(y[index[0]], y[index[1]]);
+            __m128d pz = _mm_setr_pd(z[index[0]], z[index[1]]);
+
+            __m128d distance = _mm_add_pd(_mm_mul_pd(nx, px), _mm_add_pd(_mm_mul_pd(ny, py), _mm_mul_pd(nz, pz)));
+            distance = _mm_sub_pd(distance, offset);
+            _mm_storeu_pd(distances + i, distance);
+
+            __m128d greater = _mm_cmpgt_pd(distance, best);
+            __m128i greaterMask = _mm_castpd_si128(greater);
+            best = _mm_or_pd(_mm_and_pd(greater, distance), _mm_andnot_pd(greater, best));
+            bestPosition = _mm_or_si128(_mm_and_si128(greaterMask, position), _mm_andnot_si128(greaterMask, bestPosition));
+            position = _mm_add_epi64(position, step);
+        }
+
+        double lanes[2];
+        uint64_t lanePositions[2];
+        _mm_storeu_pd(lanes, best);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanePositions), bestPosition);
+
+        return reduceLanes(lanes, lanePositions, cloud, indices, i, count, plane, distances);
+    }
+
+    void projectionBoundsSSE2(const float* x, const float* y, const float* z, uint count, const tvec3<float>* directions,
+                              uint directionsAmount, float* maximums, float* minimums) {
+        if(count < 4) { return projectionBoundsScalar(x, y, z, count, directions, directionsAmount, maximums, minimums); }
+
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            __m128 dx = _mm_set1_ps(directions[d].x);
+            __m128 dy = _mm_set1_ps(directions[d].y);
+            __m128 dz = _mm_set1_ps(directions[d].z);
+            __m128 maximum = _mm_set1_ps(-__FLT_MAX__);
+            __m128 minimum = _mm_set1_ps(__FLT_MAX__);
+
+            uint i = 0;
+            for( ; i + 4 <= count ; i += 4) {
+                __m128 projection = _mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(x + i)), _mm_add_ps(_mm_mul_ps(dy, _mm_loadu_ps(y + i)), _mm_mul_ps(dz, _mm_loadu_ps(z + i))));
+                maximum = _mm_max_ps(maximum, projection);
+                minimum = _mm_min_ps(minimum, projection);
+            }
+
+            float maximumLanes[4];
+            float minimumLanes[4];
+            _mm_storeu_ps(maximumLanes, maximum);
+            _mm_storeu_ps(minimumLanes, minimum);
+
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d], maximums[d], minimums[d]);
+        }
+    }
+
+    void projectionBoundsSSE2(const double* x, const double* y, const double* z, uint count, const tvec3<double>* directions,
+                              uint directionsAmount, double* maximums, double* minimums) {
+        if(count < 2) { return projectionBoundsScalar(x, y, z, count, directions, directionsAmount, maximums, minimums); }
+
+        for(uint d = 0 ; d < directionsAmount ; ++d) {
+            __m128d dx = _mm_set1_pd(directions[d].x);
+            __m128d dy = _mm_set1_pd(directions[d].y);
+            __m128d dz = _mm_set1_pd(directions[d].z);
+            __m128d maximum = _mm_set1_pd(-__DBL_MAX__);
+            __m128d minimum = _mm_set1_pd(__DBL_MAX__);
+
+            uint i = 0;
+            for( ; i + 2 <= count ; i += 2) {
+                __m128d projection = _mm_add_pd(_mm_mul_pd(dx, _mm_loadu_pd(x + i)), _mm_add_pd(_mm_mul_pd(dy, _mm_loadu_pd(y + i)), _mm_mul_pd(dz, _mm_loadu_pd(z + i))));
+                maximum = _mm_max_pd(maximum, projection);
+                minimum = _mm_min_pd(minimum, projection);
+            }
+
+            double maximumLanes[2];
+            double minimumLanes[2];
+            _mm_storeu_pd(maximumLanes, maximum);
+            _mm_storeu_pd(minimumLanes, minimum);
+
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d], maximums[d], minimums[d]);
+        }
+    }
+
+    /* ---- AVX2 ---- */
+
+    __attribute__((target("avx2,fma")))
+    uint distancesAVX2(const PointCloud<float>& cloud, const uint* indices, uint count, const Plane<float>& plane, float* distances) {
+        if(count < 8) { return distancesScalar(cloud, indices, count, plane, distances); }
+
+        /* The gathers read the indices as signed 32 bits integers, larger clouds are read without them */
+        if(cloud.getSize() > INT_MAX) { return distancesSSE2(cloud, indices, count, plane, distances); }
+
+        const float* x = cloud.getX();
+        const float* y = cloud.getY();
+        const float* z = cloud.getZ();
+
+        __m256 nx = _mm256_set1_ps(plane.normal.x);
+        __m256 ny = _mm256_set1_ps(plane.normal.y);
+        __m256 nz = _mm256_set1_ps(plane.normal.z);
+        __m256 offset = _mm256_set1_ps(plane.offset);
+
+        /* Each lane keeps the farthest distance it has seen and where it was in indices */
+        __m256 best = _mm256_set1_ps(-__FLT_MAX__);
+        __m256i bestPosition = _mm256_setzero_si256();
+        __m256i position = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i step = _mm256_set1_epi32(8);
+
+        uint i = 0;
+        for( ; i + 8 <= count ; i += 8) {
+            __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            __m256 px = _mm256_i32gather_ps(x, index, 4);
+            __m256 py = _mm256_i32gather_ps(y, index, 4);
+            __m256 pz = _mm256_i32gather_ps(z, index, 4);
+
+            __m256 distance = _mm256_fmadd_ps(nx, px, _mm256_fmadd_ps(ny, py, _mm256_fmsub_ps(nz, pz, offset)));
+            _mm256_storeu_ps(distances + i, distance);
+
+            __m256 greater = _mm256_cmp_ps(distance, best, _CMP_GT_OQ);
+            best = _mm256_blendv_ps(best, distance, greater);
+            bestPosition = _mm256_blendv_epi8(bestPosition, position, _mm256_castps_si256(greater));
+            position = _mm256_add_epi32(position, step);
+        }
+
+        alignas(32) float lanes[8];
+        alignas(32) uint lanePositions[8];
+        _mm256_store_ps(lanes, best);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanePositions), bestPosition);
+
+        return reduceLanes(lanes, lanePositions, cloud, indices, i, count, plane, distances);
+    }
+
+    /* Same as _mm256_i32gather_pd, whose undefined source register makes GCC warn */
+    __attribute__((target("avx2,fma")))
+    inline __m256d gather(const double* base, __m128i index) {
+        return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+    }
+
+    __attribute__((target("avx2,fma")))
+    uint distancesAVX2(const PointCloud<double>& cloud, const uint* indices, uint count, const Plane<double>& plane, double* distances) {
+        if(count < 4) { return distancesScalar(cloud, indices, count, plane, distances); }
+        if(cloud.getSize() > INT_MAX) { return distancesSSE2(cloud, indices, count, plane, distances); }
+
+        const double* x = cloud.getX();
+        const double* y = cloud.getY();
+        const double* z = cloud.getZ();
+
+        __m256d nx = _mm256_set1_pd(plane.normal.x);
+        __m256d ny = _mm256_set1_pd(plane.normal.y);
+        __m256d nz = _mm256_set1_pd(plane.normal.z);
+        __m256d offset = _mm256_set1_pd(plane.offset);
+
+        /* Each lane keeps the farthest distance it has seen and where it was in indices, as a 64 bits integer */
+        __m256d best = _mm256_set1_pd(-__DBL_MAX__);
+        __m256i bestPosition = _mm256_setzero_si256();
+        __m256i position = _mm256_setr_epi64x(0, 1, 2, 3);
+        const __m256i step = _mm256_set1_epi64x(4);
+
+        uint i = 0;
+        for( ; i + 4 <= count ; i += 4) {
+            __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+            __m256d px = gather(x, index);
+            __m256d py = gather(y, index);
+            __m256d pz = gather(z, index);
+
+            __m256d distance = _mm256_fmadd_pd(nx, px, _mm256_fmadd_pd(ny, py, _mm256_fmsub_pd(nz, pz, offset)));
+            _mm256_storeu_pd(distances + i, distance);
+
+            __m256d greater = _mm256_cmp_pd(distance, best, _CMP_GT_OQ);
+            best = _mm256_blendv_pd(best, distance, greater);
+            bestPosition = _mm256_blendv_epi8(bestPosition, position, _mm256_castpd_si256(greater));
+            position = _mm256_add_epi64(position, step);
+        }
+
+        alignas(32) double lanes[4];
+        alignas(32) uint64_t lanePositions[4];
+        _mm256_store_pd(lanes, best);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanePositions), bestPosition);
+
+        return reduceLanes(lanes, lanePositions, cloud, indices, i, count, plane, distances);
+    }
+    /* Two directions are projected at a time so their maximums and minimums do not wait on each other */
+    __attribute__((target("avx2,fma")))
+    void projectionBoundsAVX2(const float* x, const float* y, const float* z, uint count, const tvec3<float>* directions,
+                              uint directionsAmount, float* maximums, float* minimums) {
+        if(count < 8) { return projectionBoundsScalar(x, y, z, count, directions, directionsAmount, maximums, minimums); }
+
+        uint d = 0;
+        for( ; d + 2 <= directionsAmount ; d += 2) {
+            __m256 ax = _mm256_set1_ps(directions[d].x);
+            __m256 ay = _mm256_set1_ps(directions[d].y);
+            __m256 az = _mm256_set1_ps(directions[d].z);
+            __m256 bx = _mm256_set1_ps(directions[d + 1].x);
+            __m256 by = _mm256_set1_ps(directions[d + 1].y);
+            __m256 bz = _mm256_set1_ps(directions[d + 1].z);
+            __m256 maximumA = _mm256_set1_ps(-__FLT_MAX__);
+            __m256 minimumA = _mm256_set1_ps(__FLT_MAX__);
+            __m256 maximumB = maximumA;
+            __m256 minimumB = minimumA;
+
+            uint i = 0;
+            for( ; i + 8 <= count ; i += 8) {
+                __m256 px = _mm256_loadu_ps(x + i);
+                __m256 py = _mm256_loadu_ps(y + i);
+                __m256 pz = _mm256_loadu_ps(z + i);
+
+                __m256 projectionA = _mm256_fmadd_ps(ax, px, _mm256_fmadd_ps(ay, py, _mm256_mul_ps(az, pz)));
+                __m256 projectionB = _mm256_fmadd_ps(bx, px, _mm256_fmadd_ps(by, py, _mm256_mul_ps(bz, pz)));
+                maximumA = _mm256_max_ps(maximumA, projectionA);
+                minimumA = _mm256_min_ps(minimumA, projectionA);
+                maximumB = _mm256_max_ps(maximumB, projectionB);
+                minimumB = _mm256_min_ps(minimumB, projectionB);
+            }
+
+            alignas(32) float maximumLanes[8];
+            alignas(32) float minimumLanes[8];
+            _mm256_store_ps(maximumLanes, maximumA);
+            _mm256_store_ps(minimumLanes, minimumA);
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d], maximums[d], minimums[d]);
+
+            _mm256_store_ps(maximumLanes, maximumB);
+            _mm256_store_ps(minimumLanes, minimumB);
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d + 1], maximums[d + 1], minimums[d + 1]);
+        }
+
+        if(d < directionsAmount) {
+            projectionBoundsSSE2(x, y, z, count, directions + d, directionsAmount - d, maximums + d, minimums + d);
+        }
+    }
+
+    __attribute__((target("avx2,fma")))
+    void projectionBoundsAVX2(const double* x, const double* y, const double* z, uint count, const tvec3<double>* directions,
+                              uint directionsAmount, double* maximums, double* minimums) {
+        if(count < 4) { return projectionBoundsScalar(x, y, z, count, directions, directionsAmount, maximums, minimums); }
+
+        uint d = 0;
+        for( ; d + 2 <= directionsAmount ; d += 2) {
+            __m256d ax = _mm256_set1_pd(directions[d].x);
+            __m256d ay = _mm256_set1_pd(directions[d].y);
+            __m256d az = _mm256_set1_pd(directions[d].z);
+            __m256d bx = _mm256_set1_pd(directions[d + 1].x);
+            __m256d by = _mm256_set1_pd(directions[d + 1].y);
+            __m256d bz = _mm256_set1_pd(directions[d + 1].z);
+            __m256d maximumA = _mm256_set1_pd(-__DBL_MAX__);
+            __m256d minimumA = _mm256_set1_pd(__DBL_MAX__);
+            __m256d maximumB = maximumA;
+            __m256d minimumB = minimumA;
+
+            uint i = 0;
+            for( ; i + 4 <= count ; i += 4) {
+                __m256d px = _mm256_loadu_pd(x + i);
+                __m256d py = _mm256_loadu_pd(y + i);
+                __m256d pz = _mm256_loadu_pd(z + i);
+
+                __m256d projectionA = _mm256_fmadd_pd(ax, px, _mm256_fmadd_pd(ay, py, _mm256_mul_pd(az, pz)));
+                __m256d projectionB = _mm256_fmadd_pd(bx, px, _mm256_fmadd_pd(by, py, _mm256_mul_pd(bz, pz)));
+                maximumA = _mm256_max_pd(maximumA, projectionA);
+                minimumA = _mm256_min_pd(minimumA, projectionA);
+                maximumB = _mm256_max_pd(maximumB, projectionB);
+                minimumB = _mm256_min_pd(minimumB, projectionB);
+            }
+
+            alignas(32) double maximumLanes[4];
+            alignas(32) double minimumLanes[4];
+            _mm256_store_pd(maximumLanes, maximumA);
+            _mm256_store_pd(minimumLanes, minimumA);
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d], maximums[d], minimums[d]);
+
+            _mm256_store_pd(maximumLanes, maximumB);
+            _mm256_store_pd(minimumLanes, minimumB);
+            reduceBounds(maximumLanes, minimumLanes, x, y, z, i, count, directions[d + 1], maximums[d + 1], minimums[d + 1]);
+        }
+
+        if(d < directionsAmount) {
+            projectionBoundsSSE2(x, y, z, count, directions + d, directionsAmount - d, maximums + d, minimums + d);
+        }
+    }
+#endif
+
+    /**
+     * @struct Implementation
+     * @brief The versions of the kernels that are used.
+     */
+    struct Implementation {
+        uint (*distancesFloat)(const PointCloud<float>&, const uint*, uint, const Plane<float>&, float*);
+        uint (*distancesDouble)(const PointCloud<double>&, const uint*, uint, const Plane<double>&, double*);
+        void (*projectionBoundsFloat)(const float*, const float*, const float*, uint, const tvec3<float>*, uint, float*, float*);
+        void (*projectionBoundsDouble)(const double*, const double*, const double*, uint, const tvec3<double>*, uint, double*, double*);
+        const char* instructionSet;
+    };
+
+    /**
+     * @brief Picks the best versions of the kernels the processor supports.
+     * @return The versions to use.
+     */
+    Implementation select() {
+#ifdef KERNELS_X86
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return Implementation{ distancesAVX2, distancesAVX2, projectionBoundsAVX2, projectionBoundsAVX2, "AVX2" };
+        }
+
+        return Implementation{ distancesSSE2, distancesSSE2, projectionBoundsSSE2, projectionBoundsSSE2, "SSE2" };
+#else
+        return Implementation{ distancesScalar, distancesScalar, projectionBoundsScalar, projectionBoundsScalar, "Scalar" };
+#endif
+    }
+
+    /**
+     * @brief Getter for the versions of the kernels to use, picked on the first call.
+     * @return The versions to use.
+     */
+    const Implementation& getImplementation() {
+        static const Implementation implementation = select();
+        return implementation;
+    }
+}
+
+uint Kernels::distances(const PointCloud<float>& cloud, const uint* indices, uint count, const Plane<float>& plane, float* distances) {
+    return getImplementation().distancesFloat(cloud, indices, count, plane, distances);
+}
+
+uint Kernels::distances(const PointCloud<double>& cloud, const uint* indices, uint count, const Plane<double>& plane, double* distances) {
+    return getImplementation().distancesDouble(cloud, indices, count, plane, distances);
+}
+
+void Kernels::projectionBounds(const float* x, const float* y, const float* z, uint count, const tvec3<float>* directions,
+                               uint directionsAmount, float* maximums, float* minimums) {
+    getImplementation().projectionBoundsFloat(x, y, z, count, directions, directionsAmount, maximums, minimums);
+}
+
+void Kernels::projectionBounds(const double* x, const double* y, const double* z, uint count, const tvec3<double>* directions,
+                               uint directionsAmount, double* maximums, double* minimums) {
+    getImplementation().projectionBoundsDouble(x, y, z, count, directions, directionsAmount, maximums, minimums);
+}
+
+const char* Kernels::getInstructionSet() {
+    return getImplementation().instructionSet;
+}
@@ -0,0 +1,380 @@
+/***************************************************************************************************
+ * @file  parsers.cpp
+ * @brief Implementation of functions to read point clouds from text files
+ **************************************************************************************************/
+
+#include "hull/parsers.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    /* Smaller texts are not worth starting threads for */
+    constexpr std::size_t MIN_BYTES_PER_THREAD = 1 << 20;
+
+    /* Longest part of a line quoted in an error message */
+    constexpr std::size_t MAX_QUOTE_LENGTH = 64;
+
+    /* Where the coordinates are in the text */
+    struct Layout {
+        Parsers::Format format;
+        uint columns[3];        /* Position of the x, y and z numbers in a line */
+        uint lastColumn;        /* Last position that has to be read */
+        uint64_t firstLine;     /* PLY only, the index of the first vertex among the non blank lines */
+        uint64_t pointsAmount;  /* PLY only, the amount of vertices */
+    };
+
+    /* A text file mapped in memory, unmapped when it goes out of scope */
+    struct MappedText {
+        explicit MappedText(const std::string& path) : memory(nullptr), size(0) {
+            int file = open(path.c_str(), O_RDONLY);
+            if(file < 0) {
+                throw std::runtime_error("Failed to open " + path + ".");
+            }
+
+            struct stat status;
+            if(fstat(file, &status) != 0) {
+                close(file);
+                throw std::runtime_error("Failed to read the size of " + path + ".");
+            }
+            size = status.st_size;
+
+            if(size > 0) {
+                memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            }
+            close(file);
+
+            if(memory == MAP_FAILED) {
+                memory = nullptr;
+                throw std::runtime_error("Failed to map " + path + ".");
+            }
+
+            /* Each thread reads its chunk from beginning to end */
+            if(memory != nullptr) { madvise(memory, size, MADV_SEQUENTIAL); }
+        }
+
+        ~MappedText() {
+            if(memory != nullptr) { munmap(memory, size); }
+        }
+
+        MappedText(const MappedText& text) = delete;
+        MappedText& operator =(const MappedText& text) = delete;
+
+        std::string_view getText() const {
+            return std::string_view(static_cast<const char*>(memory), size);
+        }
+
+        void* memory;
+        std::size_t size;
+    };
+
+    bool isSeparator(char character) {
+        return character == ' ' || character == '\t' || character == ',' || character == ';' || character == '\r';
+    }
+
+    const char* skipSeparators(const char* cursor, const char* end) {
+        while(cursor < end && isSeparator(*cursor)) { ++cursor; }
+        return cursor;
+    }
+
+    const char* getLineEnd(const char* line, const char* end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        return lineEnd == nullptr ? end : lineEnd;
+    }
+
+    const char* getNextLine(const char* lineEnd, const char* end) {
+        return lineEnd == end ? end : lineEnd + 1;
+    }
+
+    /* Whether a line holds a point, or for PLY whether it is the line of an element */
+    bool isCounted(Parsers::Format format, const char* line, const char* end) {
+        const char* first = skipSeparators(line, end);
+        if(first == end) { return false; }
+
+        switch(format) {
+            case Parsers::Format::Xyz:
+                return (*first >= '0' && *first <= '9') || *first == '-' || *first == '+' || *first == '.';
+            case Parsers::Format::Obj:
+                return *first == 'v' && first + 1 < end && (first[1] == ' ' || first[1] == '\t');
+            case Parsers::Format::Ply:
+                return true;
+        }
+
+        return false;
+    }
+
+    [[noreturn]] void throwInvalidLine(const char* line, const char* end) {
+        std::size_t length = std::min<std::size_t>(end - line, MAX_QUOTE_LENGTH);
+        throw std::runtime_error("Invalid point in line \"" + std::string(line, length) + "\".");
+    }
+
+    template<typename Scalar>
+    tvec3<Scalar> parseLine(const Layout& layout, const char* line, const char* end) {
+        const char* cursor = skipSeparators(line, end);
+        if(layout.format == Parsers::Format::Obj) { ++cursor; }
+
+        Scalar coordinates[3];
+        for(uint column = 0 ; column <= layout.lastColumn ; ++column) {
+            cursor = skipSeparators(cursor, end);
+            if(cursor == end) { throwInvalidLine(line, end); }
+
+            uint axis = 0;
+            while(axis < 3 && layout.columns[axis] != column) { ++axis; }
+
+            /* Columns that are not coordinates are skipped without being parsed */
+            if(axis == 3) {
+                while(cursor < end && !isSeparator(*cursor)) { ++cursor; }
+                continue;
+            }
+
+            /* from_chars does not accept a leading plus sign */
+            if(*cursor == '+') { ++cursor; }
+
+            std::from_chars_result result = std::from_chars(cursor, end, coordinates[axis]);
+            if(result.ec != std::errc() || (result.ptr < end && !isSeparator(*result.ptr))) { throwInvalidLine(line, end); }
+            cursor = result.ptr;
+        }
+
+        return tvec3<Scalar>(coordinates[0], coordinates[1], coordinates[2]);
+    }
+
+    /* Runs a function on several threads, the first exception one of them throws is thrown again once they
+     * all finished */
+    template<typename Function>
+    void runInParallel(uint threadsAmount, const Function& function) {
+        std::vector<std::exception_ptr> errors(threadsAmount);
+        auto run = [&function, &errors](uint thread) {
+            try {
+                function(thread);
+            } catch(...) {
+                errors[thread] = std::current_exception();
+            }
+        };
+
+        if(threadsAmount == 1) {
+            run(0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(threadsAmount);
+
+            for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+                threads.emplace_back(run, thread);
+            }
+
+            for(std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        for(const std::exception_ptr& error : errors) {
+            if(error) { std::rethrow_exception(error); }
+        }
+    }
+
+    /* Reads the header of an ASCII PLY file and removes it from the text */
+    Layout parsePlyHeader(std::string_view& text) {
+        std::size_t headerEnd = text.find("end_header");
+        std::size_t bodyBegin = headerEnd == std::string_view::npos ? headerEnd : text.find('\n', headerEnd);
+        if(text.substr(0, 3) != "ply" || bodyBegin == std::string_view::npos) {
+            throw std::runtime_error("The PLY header has no end.");
+        }
+
+        Layout layout{ Parsers::Format::Ply, { UINT_MAX, UINT_MAX, UINT_MAX }, 0, 0, 0 };
+        bool inVertices = false;
+        bool verticesFound = false;
+        uint propertiesAmount = 0;
+
+        std::istringstream header{ std::string(text.substr(0, headerEnd)) };
+        std::string line;
+
+        while(std::getline(header, line)) {
+            std::istringstream words(line);
+            std::string keyword;
+            words >> keyword;
+
+            if(keyword == "format") {
+                std::string format;
+                words >> format;
+                if(format != "ascii") {
+                    throw std::runtime_error("Binary PLY files are read with MappedCloud, not parsed.");
+                }
+            } else if(keyword == "element") {
+                std::string name;
+                uint64_t count = 0;
+                words >> name >> count;
+
+                inVertices = !verticesFound && name == "vertex";
+                if(inVertices) {
+                    verticesFound = true;
+                    layout.pointsAmount = count;
+                } else if(!verticesFound) {
+                    layout.firstLine += count;
+                }
+            } else if(keyword == "property" && inVertices) {
+                std::string type;
+                std::string name;
+                words >> type >> name;
+
+                if(type == "list") {
+                    throw std::runtime_error("The vertices of a PLY file cannot have list properties.");
+                }
+
+                if(name.size() == 1 && name[0] >= 'x' && name[0] <= 'z') {
+                    layout.columns[name[0] - 'x'] = propertiesAmount;
+                }
+                ++propertiesAmount;
+            }
+        }
+
+        if(!verticesFound || layout.columns[0] == UINT_MAX || layout.columns[1] == UINT_MAX || layout.columns[2] == UINT_MAX) {
+            throw std::runtime_error("The PLY file has no vertex with x, y and z properties.");
+        }
+
+        layout.lastColumn = std::max({ layout.columns[0], layout.columns[1], layout.columns[2] });
+        text.remove_prefix(bodyBegin + 1);
+
+        return layout;
+    }
+
+    /* Removes the first line of an XYZ text when it only holds an integer, the amount of points PTS files
+     * start with */
+    void skipPointsAmount(std::string_view& text) {
+        const char* end = text.data() + text.size();
+        const char* lineEnd = getLineEnd(text.data(), end);
+        const char* cursor = skipSeparators(text.data(), lineEnd);
+
+        uint64_t pointsAmount;
+        std::from_chars_result result = std::from_chars(cursor, lineEnd, pointsAmount);
+        if(result.ec != std::errc() || skipSeparators(result.ptr, lineEnd) != lineEnd) { return; }
+
+        text.remove_prefix(getNextLine(lineEnd, end) - text.data());
+    }
+
+    template<typename Scalar>
+    void parsePoints(std::string_view text, Parsers::Format format, Parsers::Points<Scalar>& points, uint threadsAmount) {
+        Layout layout{ format, { 0, 1, 2 }, 2, 0, 0 };
+        if(format == Parsers::Format::Ply) { layout = parsePlyHeader(text); }
+        if(format == Parsers::Format::Xyz) { skipPointsAmount(text); }
+
+        if(threadsAmount == 0) {
+            threadsAmount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        threadsAmount = std::max<std::size_t>(std::min<std::size_t>(threadsAmount, text.size() / MIN_BYTES_PER_THREAD), 1);
+
+        /* Chunks of about the same size, each one beginning after the end of a line */
+        const char* begin = text.data();
+        const char* end = text.data() + text.size();
+        std::vector<const char*> bounds(threadsAmount + 1, end);
+        bounds[0] = begin;
+
+        for(uint thread = 1 ; thread < threadsAmount ; ++thread) {
+            const char* bound = std::max(begin + text.size() * thread / threadsAmount, bounds[thread - 1]);
+            bounds[thread] = getNextLine(getLineEnd(bound, end), end);
+        }
+
+        /* First pass, the amount of counted lines of each chunk */
+        std::vector<uint64_t> counts(threadsAmount, 0);
+
+        runInParallel(threadsAmount, [&bounds, &counts, end, format](uint thread) {
+            uint64_t count = 0;
+            for(const char* line = bounds[thread] ; line < bounds[thread + 1] ; ) {
+                const char* lineEnd = getLineEnd(line, end);
+                if(isCounted(format, line, lineEnd)) { ++count; }
+                line = getNextLine(lineEnd, end);
+            }
+            counts[thread] = count;
+        });
+
+        /* Index of the first counted line and of the first point of each chunk. For PLY, the points are the
+         * counted lines that belong to the vertex element */
+        std::vector<uint64_t> firstLines(threadsAmount + 1, 0);
+        std::vector<uint64_t> firstPoints(threadsAmount + 1, 0);
+        uint64_t pointsEnd = layout.firstLine + layout.pointsAmount;
+
+        for(uint thread = 0 ; thread < threadsAmount ; ++thread) {
+            firstLines[thread + 1] = firstLines[thread] + counts[thread];
+
+            uint64_t chunkPoints = counts[thread];
+            if(format == Parsers::Format::Ply) {
+                uint64_t first = std::max(firstLines[thread], layout.firstLine);
+                uint64_t last = std::min(firstLines[thread + 1], pointsEnd);
+                chunkPoints = last > first ? last - first : 0;
+            }
+            firstPoints[thread + 1] = firstPoints[thread] + chunkPoints;
+        }
+
+        if(format == Parsers::Format::Ply && firstLines[threadsAmount] < pointsEnd) {
+            throw std::runtime_error("The PLY file is shorter than its header says.");
+        }
+
+        /* Second pass, each chunk writes its points right after the ones of the previous chunk. The points
+         * are left uninitialized by the resize so each thread is the first to touch its own range */
+        points.resize(firstPoints[threadsAmount]);
+
+        runInParallel(threadsAmount, [&bounds, &firstLines, &firstPoints, &points, &layout, end, pointsEnd](uint thread) {
+            uint64_t index = firstLines[thread];
+            tvec3<Scalar>* output = points.data() + firstPoints[thread];
+
+            for(const char* line = bounds[thread] ; line < bounds[thread + 1] ; ) {
+                const char* lineEnd = getLineEnd(line, end);
+
+                if(isCounted(layout.format, line, lineEnd)) {
+                    if(layout.format != Parsers::Format::Ply || (index >= layout.firstLine && index < pointsEnd)) {
+                        *output++ = parseLine<Scalar>(layout, line, lineEnd);
+                    }
+                    ++index;
+                }
+                line = getNextLine(lineEnd, end);
+            }
+        });
+    }
+
+    template<typename Scalar>
+    void loadPoints(const std::string& path, Parsers::Points<Scalar>& points, uint threadsAmount) {
+        Parsers::Format format = Parsers::getFormat(path);
+        MappedText file(path);
+        parsePoints(file.getText(), format, points, threadsAmount);
+    }
+}
+
+Parsers::Format Parsers::getFormat(const std::string& path) {
+    std::size_t dot = path.find_last_of('.');
+    std::string extension = dot == std::string::npos ? "" : path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char character) {
+        return std::tolower(character);
+    });
+
+    if(extension == "obj") { return Format::Obj; }
+    if(extension == "ply") { return Format::Ply; }
+    if(extension == "xyz" || extension == "csv" || extension == "txt" || extension == "pts") { return Format::Xyz; }
+
+    throw std::runtime_error("Unknown point cloud extension: " + extension);
+}
+
+void Parsers::parse(std::string_view text, Format format, Points<float>& points, uint threadsAmount) {
+    parsePoints(text, format, points, threadsAmount);
+}
+
+void Parsers::parse(std::string_view text, Format format, Points<double>& points, uint threadsAmount) {
+    parsePoints(text, format, points, threadsAmount);
+}
+
+void Parsers::load(const std::string& path, Points<float>& points, uint threadsAmount) {
+    loadPoints(path, points, threadsAmount);
+}
+
+void Parsers::load(const std::string& path, Points<double>& points, uint threadsAmount) {
+    loadPoints(path, points, threadsAmount);
+}
@@ -0,0 +1,234 @@
+/***************************************************************************************************
+ * @file  predicates.cpp
+ * @brief Implementation of the robust geometric predicates
+ **************************************************************************************************/
+
+#include "hull/predicates.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#ifdef __FAST_MATH__
+    #error "predicates.cpp must be compiled without -ffast-math"
+#endif
+
+namespace {
+    /* ---- Expansion arithmetic ----
+     * An expansion is a sum of doubles sorted by increasing magnitude whose non zero terms do not overlap,
+     * its sign is the sign of its last term. See J. R. Shewchuk, "Adaptive Precision Floating-Point
+     * Arithmetic and Fast Robust Geometric Predicates" */
+
+    /* Largest expansion of the orientation : 3 products of a 2 terms difference with a 16 terms minor */
+    constexpr int MAX_EXPANSION_SIZE = 192;
+
+    /* Relative error bound of the double evaluation of the orientation */
+    constexpr double EPSILON = DBL_EPSILON / 2.0;
+    constexpr double ORIENTATION_BOUND = (7.0 + 56.0 * EPSILON) * EPSILON;
+
+    void twoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        double bVirtual = sum - a;
+        double aVirtual = sum - bVirtual;
+        error = (a - aVirtual) + (b - bVirtual);
+    }
+
+    void twoDifference(double a, double b, double& difference, double& error) {
+        difference = a - b;
+        double bVirtual = a - difference;
+        double aVirtual = difference + bVirtual;
+        error = (a - aVirtual) + (bVirtual - b);
+    }
+
+    void fastTwoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        error = b - (sum - a);
+    }
+
+    void twoProduct(double a, double b, double& product, double& error) {
+        product = a * b;
+        error = std::fma(a, b, -product);
+    }
+
+    /* Adds a double to an expansion, h may not be e */
+    int growExpansion(const double* e, int eSize, double b, double* h) {
+        int hSize = 0;
+        double q = b;
+
+        for(int i = 0 ; i < eSize ; ++i) {
+            double error;
+            twoSum(q, e[i], q, error);
+            if(error != 0.0) { h[hSize++] = error; }
+        }
+        if(q != 0.0 || hSize == 0) { h[hSize++] = q; }
+
+        return hSize;
+    }
+
+    /* Adds two expansions, h may not be e or f */
+    int sumExpansions(const double* e, int eSize, const double* f, int fSize, double* h) {
+        double buffer[MAX_EXPANSION_SIZE];
+        int hSize = std::copy(e, e + eSize, h) - h;
+
+        for(int i = 0 ; i < fSize ; ++i) {
+            hSize = growExpansion(h, hSize, f[i], buffer);
+            std::copy(buffer, buffer + hSize, h);
+        }
+
+        return hSize;
+    }
+
+    /* Multiplies an expansion by a double, h may not be e */
+    int scaleExpansion(const double* e, int eSize, double b, double* h) {
+        int hSize = 0;
+        double q;
+        double error;
+
+        twoProduct(e[0], b, q, error);
+        if(error != 0.0) { h[hSize++] = error; }
+
+        for(int i = 1 ; i < eSize ; ++i) {
+            double product;
+            double productError;
+            double sum;
+
+            twoProduct(e[i], b, product, productError);
+            twoSum(q, productError, sum, error);
+            if(error != 0.0) { h[hSize++] = error; }
+
+            fastTwoSum(product, sum, q, error);
+            if(error != 0.0) { h[hSize++] = error; }
+        }
+        if(q != 0.0 || hSize == 0) { h[hSize++] = q; }
+
+        return hSize;
+    }
+
+    /* Multiplies two expansions, h may not be e or f */
+    int multiplyExpansions(const double* e, int eSize, const double* f, int fSize, double* h) {
+        double scaled[MAX_EXPANSION_SIZE];
+        double sum[MAX_EXPANSION_SIZE];
+        int hSize = 1;
+        h[0] = 0.0;
+
+        for(int i = 0 ; i < fSize ; ++i) {
+            int scaledSize = scaleExpansion(e, eSize, f[i], scaled);
+            int sumSize = sumExpansions(h, hSize, scaled, scaledSize, sum);
+            hSize = std::copy(sum, sum + sumSize, h) - h;
+        }
+
+        return hSize;
+    }
+
+    /* Exact value of the orientation, the coordinates are turned into exact two terms differences */
+    template<typename Scalar>
+    double exactOrientation(const tvec3<Scalar>& a, const tvec3<Scalar>& b, const tvec3<Scalar>& c, const tvec3<Scalar>& d) {
+        const double points[4][3] = { { a.x, a.y, a.z }, { b.x, b.y, b.z }, { c.x, c.y, c.z }, { d.x, d.y, d.z } };
+        double u[3][2];
+        double v[3][2];
+        double w[3][2];
+
+        for(int i = 0 ; i < 3 ; ++i) {
+            twoDifference(points[1][i], points[0][i], u[i][1], u[i][0]);
+            twoDifference(points[2][i], points[0][i], v[i][1], v[i][0]);
+            twoDifference(points[3][i], points[0][i], w[i][1], w[i][0]);
+        }
+
+        /* dot(u, cross(v, w)) */
+        double determinant[MAX_EXPANSION_SIZE];
+        int determinantSize = 1;
+        determinant[0] = 0.0;
+
+        for(int i = 0 ; i < 3 ; ++i) {
+            int j = (i + 1) % 3;
+            int k = (i + 2) % 3;
+
+            double positive[8];
+            double negative[8];
+            int positiveSize = multiplyExpansions(v[j], 2, w[k], 2, positive);
+            int negativeSize = multiplyExpansions(v[k], 2, w[j], 2, negative);
+            for(int n = 0 ; n < negativeSize ; ++n) { negative[n] = -negative[n]; }
+
+            double minor[16];
+            int minorSize = sumExpansions(positive, positiveSize, negative, negativeSize, minor);
+
+            double term[64];
+            int termSize = multiplyExpansions(minor, minorSize, u[i], 2, term);
+
+            double sum[MAX_EXPANSION_SIZE];
+            int sumSize = sumExpansions(determinant, determinantSize, term, termSize, sum);
+            determinantSize = std::copy(sum, sum + sumSize, determinant) - determinant;
+        }
+
+        return determinant[determinantSize - 1];
+    }
+
+    /* Orientation evaluated in double precision, recalculated exactly when its sign is uncertain */
+    template<typename Scalar>
+    double filteredOrientation(const tvec3<Scalar>& a, const tvec3<Scalar>& b, const tvec3<Scalar>& c, const tvec3<Scalar>& d) {
+        double ux = static_cast<double>(b.x) - a.x;
+        double uy = static_cast<double>(b.y) - a.y;
+        double uz = static_cast<double>(b.z) - a.z;
+        double vx = static_cast<double>(c.x) - a.x;
+        double vy = static_cast<double>(c.y) - a.y;
+        double vz = static_cast<double>(c.z) - a.z;
+        double wx = static_cast<double>(d.x) - a.x;
+        double wy = static_cast<double>(d.y) - a.y;
+        double wz = static_cast<double>(d.z) - a.z;
+
+        double vywz = vy * wz;
+        double vzwy = vz * wy;
+        double vzwx = vz * wx;
+        double vxwz = vx * wz;
+        double vxwy = vx * wy;
+        double vywx = vy * wx;
+
+        double determinant = ux * (vywz - vzwy) + uy * (vzwx - vxwz) + uz * (vxwy - vywx);
+        double permanent = std::abs(ux) * (std::abs(vywz) + std::abs(vzwy))
+                         + std::abs(uy) * (std::abs(vzwx) + std::abs(vxwz))
+                         + std::abs(uz) * (std::abs(vxwy) + std::abs(vywx));
+
+        if(std::abs(determinant) > ORIENTATION_BOUND * permanent) { return determinant; }
+
+        return exactOrientation(a, b, c, d);
+    }
+
+    /* Bound of the error of the distance to the plane of a triangle evaluated with Scalar */
+    template<typename Scalar>
+    Scalar planeErrorBound(const tvec3<Scalar>& a, const tvec3<Scalar>& b, const tvec3<Scalar>& c, Scalar magnitude) {
+        tvec3<Scalar> u = b - a;
+        tvec3<Scalar> v = c - a;
+
+        Scalar edges = std::max({ std::abs(u.x), std::abs(u.y), std::abs(u.z), std::abs(v.x), std::abs(v.y), std::abs(v.z) });
+        Scalar coordinates = std::max({ magnitude, std::abs(a.x), std::abs(a.y), std::abs(a.z), std::abs(b.x), std::abs(b.y),
+                                        std::abs(b.z), std::abs(c.x), std::abs(c.y), std::abs(c.z) });
+
+        /* With u = epsilon / 2, E = edges and M = coordinates, each component of the normal is off by less
+         * than 8u E² and bounded by 2E², which moves the distance by less than 3 * 8u E² * 2M = 48u E² M.
+         * The offset, a dot product with the rounded normal, is off by less than 3u * 3 * 2E² M = 18u E² M.
+         * The distance sums the three products and the offset with three roundings, in any order and fused
+         * or not, so it is off by less than 3u * 12E² M = 36u E² M. The first order total is 102u E² M,
+         * about 51 epsilon E² M, the rest covers the higher order terms. This only holds for code built
+         * with IEEE rounding of every operation, hence -fno-fast-math -ffp-contract=off */
+        return 64 * std::numeric_limits<Scalar>::epsilon() * edges * edges * coordinates;
+    }
+}
+
+namespace Predicates {
+    double orientation(const vec3& a, const vec3& b, const vec3& c, const vec3& d) {
+        return filteredOrientation(a, b, c, d);
+    }
+
+    double orientation(const dvec3& a, const dvec3& b, const dvec3& c, const dvec3& d) {
+        return filteredOrientation(a, b, c, d);
+    }
+
+    float getPlaneErrorBound(const vec3& a, const vec3& b, const vec3& c, float magnitude) {
+        return planeErrorBound(a, b, c, magnitude);
+    }
+
+    double getPlaneErrorBound(const dvec3& a, const dvec3& b, const dvec3& c, double magnitude) {
+        return planeErrorBound(a, b, c, magnitude);
+    }
+}
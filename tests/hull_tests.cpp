@@ -0,0 +1,319 @@
+/***************************************************************************************************
+ * @file  hull_tests.cpp
+ * @brief Contains the checks of the validity of the hulls on degenerate inputs
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hull/ConvexHull.hpp"
+#include "hull/generators.hpp"
+#include "hull/predicates.hpp"
+#include "hull/StreamingHull.hpp"
+
+static uint failures = 0; ///< The amount of failed checks.
+
+/**
+ * @brief Reports a failed check.
+ * @param condition Whether the check passed.
+ * @param name The name of the case.
+ * @param message What failed.
+ */
+static void check(bool condition, const std::string& name, const std::string& message) {
+    if(condition) { return; }
+
+    std::printf("FAILED %s: %s\n", name.c_str(), message.c_str());
+    ++failures;
+}
+
+/**
+ * @brief Checks that an indexed mesh is a closed 2-manifold of genus 0 that contains points. Each directed
+ * edge has to appear once with its reverse appearing once, and V - E + F has to be 2.
+ * @tparam Scalar The type of the coordinates.
+ * @param name The name of the case.
+ * @param vertices The vertices of the mesh.
+ * @param triangles The indices in vertices of the vertices of each face, 3 per face.
+ * @param points The points the mesh has to contain.
+ * @param tolerance 0 to test the containment with the exact predicate, otherwise the largest distance a
+ * point can be above a face relative to the size of the points.
+ */
+template<typename Scalar>
+static void checkMesh(const std::string& name, const std::vector<tvec3<Scalar>>& vertices, const std::vector<uint>& triangles,
+                      const std::vector<tvec3<Scalar>>& points, double tolerance = 0) {
+    const bool closed = triangles.size() >= 12 && triangles.size() % 3 == 0;
+    check(closed, name, "not a closed mesh of triangles");
+    if(!closed) { return; }
+
+    std::map<std::pair<uint, uint>, uint> edges;
+    for(uint i = 0 ; i < triangles.size() ; i += 3) {
+        for(uint k = 0 ; k < 3 ; ++k) {
+            ++edges[std::make_pair(triangles[i + k], triangles[i + (k + 1) % 3])];
+        }
+    }
+
+    bool manifold = true;
+    for(const auto& [edge, count] : edges) {
+        auto twin = edges.find(std::make_pair(edge.second, edge.first));
+        manifold = manifold && count == 1 && twin != edges.end() && twin->second == 1;
+    }
+    check(manifold, name, "an edge is not shared by exactly two faces with opposite directions");
+
+    std::vector<bool> used(vertices.size(), false);
+    for(uint index : triangles) { used[index] = true; }
+    long verticesAmount = std::count(used.begin(), used.end(), true);
+    long eulerCharacteristic = verticesAmount - static_cast<long>(edges.size() / 2) + static_cast<long>(triangles.size() / 3);
+    check(eulerCharacteristic == 2, name, "V - E + F is " + std::to_string(eulerCharacteristic));
+
+    Scalar magnitude = 0;
+    for(const tvec3<Scalar>& point : points) {
+        magnitude = std::max(magnitude, std::max(std::abs(point.x), std::max(std::abs(point.y), std::abs(point.z))));
+    }
+
+    uint outside = 0;
+    for(const tvec3<Scalar>& point : points) {
+        for(uint i = 0 ; i < triangles.size() ; i += 3) {
+            const tvec3<Scalar>& a = vertices[triangles[i]];
+            const tvec3<Scalar>& b = vertices[triangles[i + 1]];
+            const tvec3<Scalar>& c = vertices[triangles[i + 2]];
+
+            bool above;
+            if(tolerance == 0) {
+                above = Predicates::orientation(a, b, c, point) > 0.0;
+            } else {
+                dvec3 A(a.x, a.y, a.z);
+                dvec3 normal = cross(dvec3(b.x, b.y, b.z) - A, dvec3(c.x, c.y, c.z) - A);
+                above = dot(normal, dvec3(point.x, point.y, point.z) - A) > tolerance * magnitude * length(normal);
+            }
+
+            if(above) {
+                ++outside;
+                break;
+            }
+        }
+    }
+    check(outside == 0, name, std::to_string(outside) + " points are outside");
+}
+
+/**
+ * @brief Checks the hull of a ConvexHull against the points it was built from.
+ * @tparam Scalar The type of the coordinates.
+ * @param name The name of the case.
+ * @param hull The hull.
+ * @param points The points.
+ */
+template<typename Scalar>
+static void checkHull(const std::string& name, const ConvexHull<Scalar>& hull, const std::vector<tvec3<Scalar>>& points) {
+    std::vector<tvec3<Scalar>> vertices;
+    std::vector<uint> triangles;
+    hull.getIndexedMesh(vertices, triangles);
+    checkMesh(name, vertices, triangles, points);
+}
+
+/**
+ * @brief Creates the degenerate inputs of the checks: flattened, gridded, scaled and duplicated points.
+ * @tparam Scalar The type of the coordinates.
+ * @param pointsAmount The amount of random points each input is made from.
+ * @return The name and points of each input.
+ */
+template<typename Scalar>
+static std::vector<std::pair<std::string, std::vector<tvec3<Scalar>>>> getInputs(uint pointsAmount) {
+    std::vector<std::pair<std::string, std::vector<tvec3<Scalar>>>> inputs;
+
+    std::vector<tvec3<Scalar>> cube(pointsAmount);
+    Generators::generate(cube.data(), pointsAmount, Generators::Distribution::Cube, 1);
+    inputs.emplace_back("cube", cube);
+
+    std::vector<tvec3<Scalar>> flat = cube;
+    for(tvec3<Scalar>& point : flat) { point.z *= Scalar(1e-6); }
+    inputs.emplace_back("flat", flat);
+
+    /* Many points on each face, edge and plane of the grid */
+    std::vector<tvec3<Scalar>> grid;
+    uint side = std::max<uint>(2, std::cbrt(pointsAmount));
+    for(uint i = 0 ; i < side * side * side ; ++i) {
+        grid.emplace_back(i % side, i / side % side, i / side / side);
+    }
+    inputs.emplace_back("grid", grid);
+
+    /* The planes are computed with products of 3 coordinates, which have to stay in the range of Scalar */
+    const Scalar scale = std::is_same_v<Scalar, float> ? 1e9 : 1e15;
+    std::vector<tvec3<Scalar>> large = cube;
+    std::vector<tvec3<Scalar>> small = cube;
+    for(tvec3<Scalar>& point : large) { point *= scale; }
+    for(tvec3<Scalar>& point : small) { point /= scale; }
+    inputs.emplace_back("large", large);
+    inputs.emplace_back("small", small);
+
+    std::vector<tvec3<Scalar>> duplicated;
+    for(uint copy = 0 ; copy < 3 ; ++copy) {
+        duplicated.insert(duplicated.end(), grid.begin(), grid.end());
+    }
+    inputs.emplace_back("duplicated", duplicated);
+
+    /* A square of points with a single point above it, read last by the streaming hulls */
+    std::vector<tvec3<Scalar>> pyramid;
+    for(uint i = 0 ; i < std::min(pointsAmount, 2000u) ; ++i) {
+        pyramid.emplace_back(cube[i].x, cube[i].y, 0);
+    }
+    pyramid.emplace_back(0, 0, 1);
+    inputs.emplace_back("pyramid", pyramid);
+
+    std::vector<tvec3<Scalar>> sphere(std::min(pointsAmount, 500u));
+    Generators::generate(sphere.data(), sphere.size(), Generators::Distribution::Sphere, 2);
+    inputs.emplace_back("sphere", sphere);
+
+    return inputs;
+}
+
+/**
+ * @brief Checks the builds, insertions and degenerate cases of ConvexHull.
+ * @tparam Scalar The type of the coordinates.
+ * @param type The name of the type.
+ */
+template<typename Scalar>
+static void checkConvexHull(const std::string& type) {
+    for(const auto& [inputName, points] : getInputs<Scalar>(20000)) {
+        const std::string name = type + " " + inputName;
+
+        for(uint threadsAmount : { 1u, 4u }) {
+            ConvexHull<Scalar> hull;
+            hull.build(points, threadsAmount);
+            checkHull(name + " build " + std::to_string(threadsAmount) + " threads", hull, points);
+        }
+
+        /* Half of the points are built from, the others inserted */
+        std::vector<tvec3<Scalar>> first(points.begin() + points.size() / 2, points.end());
+        std::vector<tvec3<Scalar>> second(points.begin(), points.begin() + points.size() / 2);
+
+        /* The first half of every input spans a volume */
+        ConvexHull<Scalar> hull;
+        const bool built = hull.tryBuild(first);
+        check(built, name + " insert", "the first half has no hull");
+        if(!built) { continue; }
+
+        hull.insert(second);
+        checkHull(name + " insert", hull, points);
+    }
+
+    /* Inputs without volume throw */
+    const std::vector<std::pair<std::string, std::vector<tvec3<Scalar>>>> degenerates{
+        { "empty", {} },
+        { "three points", { tvec3<Scalar>(0, 0, 0), tvec3<Scalar>(1, 0, 0), tvec3<Scalar>(0, 1, 0) } },
+        { "equal", std::vector<tvec3<Scalar>>(10, tvec3<Scalar>(1, 2, 3)) },
+        { "collinear", { tvec3<Scalar>(0, 0, 0), tvec3<Scalar>(1, 1, 1), tvec3<Scalar>(2, 2, 2), tvec3<Scalar>(3, 3, 3), tvec3<Scalar>(-1, -1, -1) } },
+        { "coplanar", { tvec3<Scalar>(0, 0, 5), tvec3<Scalar>(1, 0, 5), tvec3<Scalar>(0, 1, 5), tvec3<Scalar>(1, 1, 5), tvec3<Scalar>(0.5, 0.25, 5) } }
+    };
+
+    for(const auto& [inputName, points] : degenerates) {
+        bool thrown = false;
+        try {
+            ConvexHull<Scalar>().build(points);
+        } catch(const std::runtime_error&) {
+            thrown = true;
+        }
+        check(thrown, type + " " + inputName, "the build did not throw");
+    }
+
+    /* Flat clouds whose only point off their plane is one ulp above or below it, so the first tetrahedron is
+     * a sliver whose rounded centroid is on the plane */
+    for(Scalar direction : { Scalar(2), Scalar(0) }) {
+        std::vector<tvec3<Scalar>> sliver(1000);
+        Generators::generate(sliver.data(), sliver.size(), Generators::Distribution::Cube, 3);
+        for(tvec3<Scalar>& point : sliver) { point.z = 1; }
+        sliver[sliver.size() / 2].z = std::nextafter(Scalar(1), direction);
+
+        const std::string name = type + (direction > 1 ? " sliver above" : " sliver below");
+        ConvexHull<Scalar> hull;
+        check(hull.tryBuild(sliver), name, "the points do not span a volume");
+        checkHull(name, hull, sliver);
+    }
+}
+
+/**
+ * @brief Checks the hulls of StreamingHull, whose chunks are smaller than the inputs.
+ * @tparam Scalar The type of the coordinates.
+ * @param type The name of the type.
+ */
+template<typename Scalar>
+static void checkStreamingHull(const std::string& type) {
+    for(const auto& [inputName, points] : getInputs<Scalar>(5000)) {
+        const std::string name = type + " " + inputName + " streaming";
+
+        StreamingHull<Scalar> hull(500, 1);
+        uint64_t position = 0;
+        hull.build([&points, &position](tvec3<Scalar>* chunk, uint64_t capacity) -> uint64_t {
+            uint64_t count = std::min<uint64_t>(capacity, points.size() - position);
+            std::copy_n(points.begin() + position, count, chunk);
+            position += count;
+            return count;
+        });
+
+        checkMesh(name, hull.getVertices(), hull.getTriangles(), points);
+    }
+}
+
+/**
+ * @brief Checks that the enclosing meshes of hulls with a vertex budget contain all the points.
+ * @tparam Scalar The type of the coordinates.
+ * @param type The name of the type.
+ */
+template<typename Scalar>
+static void checkEnclosingMesh(const std::string& type) {
+    for(const auto& [inputName, points] : getInputs<Scalar>(20000)) {
+        const std::string name = type + " " + inputName + " enclosing";
+
+        ConvexHull<Scalar> hull;
+        hull.setMaxVertices(16);
+        hull.build(points);
+        check(hull.getVertices().size() <= 16, name, "the budget is exceeded");
+
+        std::vector<tvec3<Scalar>> vertices;
+        std::vector<uint> triangles;
+        hull.getEnclosingMesh(vertices, triangles);
+        checkMesh(name, vertices, triangles, points, 1e-4 * std::numeric_limits<Scalar>::epsilon());
+
+        /* The points left outside by the budget have to be kept when more points are inserted */
+        std::vector<tvec3<Scalar>> first(points.begin() + points.size() / 100, points.end());
+        std::vector<tvec3<Scalar>> second(points.begin(), points.begin() + points.size() / 100);
+
+        ConvexHull<Scalar> insertedHull;
+        insertedHull.setMaxVertices(16);
+        const bool built = insertedHull.tryBuild(first);
+        check(built, name + " insert", "the first points have no hull");
+        if(!built) { continue; }
+
+        insertedHull.insert(second);
+        insertedHull.getEnclosingMesh(vertices, triangles);
+        checkMesh(name + " insert", vertices, triangles, points, 1e-4 * std::numeric_limits<Scalar>::epsilon());
+    }
+}
+
+/**
+ * @brief Runs the checks.
+ * @return 0 when they all pass, 1 otherwise.
+ */
+int main() {
+    checkConvexHull<float>("float");
+    checkConvexHull<double>("double");
+    checkStreamingHull<float>("float");
+    checkStreamingHull<double>("double");
+    checkEnclosingMesh<float>("float");
+    checkEnclosingMesh<double>("double");
+
+    if(failures > 0) {
+        std::printf("%u checks failed\n", failures);
+        return 1;
+    }
+
+    std::printf("All checks passed\n");
+    return 0;
+}